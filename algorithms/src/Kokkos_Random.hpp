@@ -23,6 +23,7 @@
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Complex.hpp>
+#include <Kokkos_SIMD.hpp>
 #include <cstdio>
 #include <cstdlib>
 #include <cmath>
@@ -33,6 +34,10 @@
 /// These generators are based on Vigna, Sebastiano (2014). "An
 /// experimental exploration of Marsaglia's xorshift generators,
 /// scrambled."  See: http://arxiv.org/abs/1402.6246
+///
+/// The counter-based generators in Kokkos::Experimental (Philox4x32 and
+/// Threefry2x64) follow Salmon et al. (2011), "Parallel random numbers: as
+/// easy as 1, 2, 3".
 
 namespace Kokkos {
 
@@ -1214,6 +1219,551 @@ class Random_XorShift1024_Pool {
   }
 };
 
+// Counter-based generators
+//
+// These generators are based on Salmon, Moraes, Dror and Shaw (2011).
+// "Parallel random numbers: as easy as 1, 2, 3". A keyed bijection maps
+// (seed, stream, counter) to a block of 128 random bits, so a generator is
+// fully described by those three integers and no state has to be stored,
+// locked or written back. Drawing from stream s of a pool seeded with seed
+// always yields the same sequence, independent of the number of threads and
+// of the order in which they are scheduled.
+
+namespace Impl {
+
+// Philox4x32-10: 10 rounds of a multiply-hi/lo Feistel-like network on four
+// 32-bit words with a 64-bit key.
+struct Random_Philox4x32_10 {
+  KOKKOS_INLINE_FUNCTION
+  static void apply(uint32_t (&ctr)[4], const uint32_t (&key)[2]) {
+    uint32_t k0 = key[0];
+    uint32_t k1 = key[1];
+    for (int r = 0; r < 10; ++r) {
+      if (r > 0) {
+        k0 += 0x9E3779B9U;
+        k1 += 0xBB67AE85U;
+      }
+      const uint64_t p0 = static_cast<uint64_t>(0xD2511F53U) * ctr[0];
+      const uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57U) * ctr[2];
+      const uint32_t c1 = ctr[1];
+      const uint32_t c3 = ctr[3];
+      ctr[0]            = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+      ctr[1]            = static_cast<uint32_t>(p1);
+      ctr[2]            = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+      ctr[3]            = static_cast<uint32_t>(p0);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void generate(uint64_t seed, uint64_t stream, uint64_t counter,
+                       uint64_t (&block)[2]) {
+    uint32_t ctr[4]       = {static_cast<uint32_t>(counter),
+                             static_cast<uint32_t>(counter >> 32),
+                             static_cast<uint32_t>(stream),
+                             static_cast<uint32_t>(stream >> 32)};
+    const uint32_t key[2] = {static_cast<uint32_t>(seed),
+                             static_cast<uint32_t>(seed >> 32)};
+    apply(ctr, key);
+    block[0] = static_cast<uint64_t>(ctr[0]) |
+               (static_cast<uint64_t>(ctr[1]) << 32);
+    block[1] = static_cast<uint64_t>(ctr[2]) |
+               (static_cast<uint64_t>(ctr[3]) << 32);
+  }
+
+  // Same as generate, with Word either uint64_t or a simd<uint64_t> pack that
+  // evaluates one block per lane. The 32-bit words are kept in the low half of
+  // 64-bit lanes so that the 32x32->64 products fit.
+  template <class Word>
+  KOKKOS_INLINE_FUNCTION static void generate_lanes(uint64_t seed,
+                                                    Word const& stream,
+                                                    Word const& counter,
+                                                    Word (&block)[2]) {
+    const Word lo32(uint64_t(0xFFFFFFFFU));
+    const Word m0(uint64_t(0xD2511F53U));
+    const Word m1(uint64_t(0xCD9E8D57U));
+    Word c0     = counter & lo32;
+    Word c1     = counter >> 32;
+    Word c2     = stream & lo32;
+    Word c3     = stream >> 32;
+    uint32_t k0 = static_cast<uint32_t>(seed);
+    uint32_t k1 = static_cast<uint32_t>(seed >> 32);
+    for (int r = 0; r < 10; ++r) {
+      if (r > 0) {
+        k0 += 0x9E3779B9U;
+        k1 += 0xBB67AE85U;
+      }
+      const Word p0 = m0 * c0;
+      const Word p1 = m1 * c2;
+      c0            = (p1 >> 32) ^ c1 ^ Word(uint64_t(k0));
+      c1            = p1 & lo32;
+      c2            = (p0 >> 32) ^ c3 ^ Word(uint64_t(k1));
+      c3            = p0 & lo32;
+    }
+    block[0] = c0 | (c1 << 32);
+    block[1] = c2 | (c3 << 32);
+  }
+};
+
+// Threefry2x64-20: 20 rounds of the Threefish add-rotate-xor mix on two
+// 64-bit words with a 128-bit key.
+struct Random_Threefry2x64_20 {
+  template <class Word>
+  KOKKOS_INLINE_FUNCTION static Word rotl(Word const& x, int r) {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  // Word is either uint64_t or a simd<uint64_t> pack (one block per lane)
+  template <class Word>
+  KOKKOS_INLINE_FUNCTION static void apply(Word (&ctr)[2],
+                                           const uint64_t (&key)[2]) {
+    constexpr int rotations[8] = {16, 42, 12, 31, 16, 32, 24, 21};
+    const uint64_t ks[3]       = {key[0], key[1],
+                                  0x1BD11BDAA9FC1A22ULL ^ key[0] ^ key[1]};
+    Word x0                    = ctr[0] + Word(ks[0]);
+    Word x1                    = ctr[1] + Word(ks[1]);
+    for (int r = 0; r < 20; ++r) {
+      x0 = x0 + x1;
+      x1 = rotl(x1, rotations[r % 8]);
+      x1 = x1 ^ x0;
+      if (r % 4 == 3) {
+        const int s = r / 4 + 1;
+        x0          = x0 + Word(ks[s % 3]);
+        x1          = x1 + Word(ks[(s + 1) % 3] + s);
+      }
+    }
+    ctr[0] = x0;
+    ctr[1] = x1;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  static void generate(uint64_t seed, uint64_t stream, uint64_t counter,
+                       uint64_t (&block)[2]) {
+    block[0]              = counter;
+    block[1]              = stream;
+    const uint64_t key[2] = {seed, 0};
+    apply(block, key);
+  }
+
+  template <class Word>
+  KOKKOS_INLINE_FUNCTION static void generate_lanes(uint64_t seed,
+                                                    Word const& stream,
+                                                    Word const& counter,
+                                                    Word (&block)[2]) {
+    block[0]              = counter;
+    block[1]              = stream;
+    const uint64_t key[2] = {seed, 0};
+    apply(block, key);
+  }
+};
+
+template <class Bijection, class DeviceType>
+class Random_CounterBased {
+ private:
+  uint64_t seed_;
+  uint64_t stream_;
+  uint64_t counter_;
+  uint64_t block_[2];
+  int remaining_;
+
+ public:
+  using device_type    = DeviceType;
+  using bijection_type = Bijection;
+
+  constexpr static uint32_t MAX_URAND   = std::numeric_limits<uint32_t>::max();
+  constexpr static uint64_t MAX_URAND64 = std::numeric_limits<uint64_t>::max();
+  constexpr static int32_t MAX_RAND     = std::numeric_limits<int32_t>::max();
+  constexpr static int64_t MAX_RAND64   = std::numeric_limits<int64_t>::max();
+
+  // Position the generator at 128-bit block 'offset' of stream 'stream'.
+  KOKKOS_INLINE_FUNCTION
+  Random_CounterBased(uint64_t seed, uint64_t stream, uint64_t offset = 0)
+      : seed_(seed),
+        stream_(stream),
+        counter_(offset),
+        block_{0, 0},
+        remaining_(0) {}
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t stream() const { return stream_; }
+
+  // Index of the next 128-bit block that will be generated.
+  KOKKOS_INLINE_FUNCTION
+  uint64_t offset() const { return counter_; }
+
+  // Skip n 128-bit blocks in constant time.
+  KOKKOS_INLINE_FUNCTION
+  void discard_blocks(uint64_t n) {
+    counter_ += n;
+    remaining_ = 0;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64() {
+    if (remaining_ == 0) {
+      Bijection::generate(seed_, stream_, counter_++, block_);
+      remaining_ = 2;
+    }
+    return block_[2 - remaining_--];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand() { return static_cast<uint32_t>(urand64() >> 32); }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& range) {
+    const uint32_t max_val = (MAX_URAND / range) * range;
+    uint32_t tmp           = urand();
+    while (tmp >= max_val) tmp = urand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint32_t urand(const uint32_t& start, const uint32_t& end) {
+    return urand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& range) {
+    const uint64_t max_val = (MAX_URAND64 / range) * range;
+    uint64_t tmp           = urand64();
+    while (tmp >= max_val) tmp = urand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t urand64(const uint64_t& start, const uint64_t& end) {
+    return urand64(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand() { return static_cast<int>(urand() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& range) {
+    const int max_val = (MAX_RAND / range) * range;
+    int tmp           = rand();
+    while (tmp >= max_val) tmp = rand();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int rand(const int& start, const int& end) {
+    return rand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64() { return static_cast<int64_t>(urand64() / 2); }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& range) {
+    const int64_t max_val = (MAX_RAND64 / range) * range;
+    int64_t tmp           = rand64();
+    while (tmp >= max_val) tmp = rand64();
+    return tmp % range;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int64_t rand64(const int64_t& start, const int64_t& end) {
+    return rand64(end - start) + start;
+  }
+
+  // Use the upper 24 (resp. 52) bits so that the result is exactly
+  // representable and lies in [0,1). drand matches the bulk SIMD path, which
+  // builds the double directly from its mantissa bits.
+  KOKKOS_INLINE_FUNCTION
+  float frand() { return (urand64() >> 40) * (1.0f / 16777216.0f); }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& range) { return range * frand(); }
+
+  KOKKOS_INLINE_FUNCTION
+  float frand(const float& start, const float& end) {
+    return frand(end - start) + start;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand() { return (urand64() >> 12) * (1.0 / 4503599627370496.0); }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& range) { return range * drand(); }
+
+  KOKKOS_INLINE_FUNCTION
+  double drand(const double& start, const double& end) {
+    return drand(end - start) + start;
+  }
+
+  // Box-muller method for drawing a standard normal distributed random
+  // number
+  KOKKOS_INLINE_FUNCTION
+  double normal() {
+    constexpr auto two_pi = 2 * Kokkos::numbers::pi_v<double>;
+
+    const double u     = 1.0 - drand();  // in (0,1]
+    const double v     = drand();
+    const double r     = Kokkos::sqrt(-2.0 * Kokkos::log(u));
+    const double theta = v * two_pi;
+    return r * Kokkos::cos(theta);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  double normal(const double& mean, const double& std_dev = 1.0) {
+    return mean + normal() * std_dev;
+  }
+
+  // Inversion method for drawing an exponentially distributed random number
+  // with rate 1
+  KOKKOS_INLINE_FUNCTION
+  double exponential() { return -Kokkos::log(1.0 - drand()); }
+
+  KOKKOS_INLINE_FUNCTION
+  double exponential(const double& rate) { return exponential() / rate; }
+};
+
+// The pool stores the seed and a count of the bulk fills drawn from it.
+// get_state(stream) is a pure function of (seed, stream), does not involve
+// atomics and may be called concurrently for the same stream; free_state is a
+// no-op provided for interface compatibility with the stateful pools.
+//
+// The k-th fill_random call (k = 1, 2, ...) on a pool or any of its copies
+// draws from offset k * blocks_per_fill of its streams, so that successive
+// fills yield different numbers and never overlap the blocks handed out by
+// get_state(stream).
+template <class Bijection, class DeviceType>
+class Random_CounterBased_Pool {
+ public:
+  using device_type    = typename DeviceType::device_type;
+  using generator_type = Random_CounterBased<Bijection, DeviceType>;
+
+  constexpr static uint64_t blocks_per_fill = uint64_t(1) << 32;
+
+ private:
+  uint64_t seed_ = {};
+  Kokkos::View<uint64_t, Kokkos::HostSpace> fill_count_;
+
+ public:
+  Random_CounterBased_Pool() = default;
+
+  Random_CounterBased_Pool(uint64_t seed) { init(seed); }
+
+  void init(uint64_t seed) {
+    seed_       = seed;
+    fill_count_ = Kokkos::View<uint64_t, Kokkos::HostSpace>(
+        "Kokkos::Random_CounterBased_Pool::fill_count");
+  }
+
+  // num_states is ignored: every 64-bit stream index is valid.
+  void init(uint64_t seed, int /*num_states*/) { init(seed); }
+
+  KOKKOS_INLINE_FUNCTION
+  uint64_t seed() const { return seed_; }
+
+  // Reserve the offset of the next bulk fill
+  uint64_t impl_next_fill_offset() const {
+    if (fill_count_.data() == nullptr) {
+      Kokkos::abort(
+          "Kokkos::fill_random: counter-based random pool used before "
+          "init()");
+    }
+    return (Kokkos::atomic_fetch_add(fill_count_.data(), uint64_t(1)) + 1) *
+           blocks_per_fill;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  generator_type get_state(uint64_t stream, uint64_t offset = 0) const {
+    return generator_type(seed_, stream, offset);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void free_state(const generator_type&) const {}
+};
+
+template <class RandomPool>
+struct is_counter_based_random_pool : std::false_type {};
+
+template <class Bijection, class DeviceType>
+struct is_counter_based_random_pool<
+    Random_CounterBased_Pool<Bijection, DeviceType>> : std::true_type {};
+
+// Counter-based pools hand out the stream for work item i, so that the
+// numbers drawn for i do not depend on which thread executes it.
+template <class RandomPool, class IndexType>
+KOKKOS_INLINE_FUNCTION typename RandomPool::generator_type
+random_pool_get_state(const RandomPool& pool, IndexType i) {
+  if constexpr (is_counter_based_random_pool<RandomPool>::value) {
+    return pool.get_state(static_cast<uint64_t>(i));
+  } else {
+    (void)i;
+    return pool.get_state();
+  }
+}
+
+// Evaluates the first block of simd<double, Abi>::size() consecutive streams
+// at once. Lane l of every pack below reproduces the first draws of
+// pool.get_state(first_stream + l, offset).
+template <class Bijection, class Abi>
+struct Random_CounterBased_Lanes {
+  using bits_type  = Kokkos::Experimental::simd<std::uint64_t, Abi>;
+  using value_type = Kokkos::Experimental::simd<double, Abi>;
+
+  KOKKOS_INLINE_FUNCTION
+  static void first_block(uint64_t seed, uint64_t first_stream,
+                          uint64_t offset, bits_type (&block)[2]) {
+    const bits_type stream =
+        bits_type(first_stream) +
+        bits_type([](std::size_t lane) { return std::uint64_t(lane); });
+    Bijection::generate_lanes(seed, stream, bits_type(offset), block);
+  }
+
+  // Same value as Random_CounterBased::drand(): the upper 52 bits become the
+  // mantissa of a double in [1,2), no integer to floating point conversion
+  // is needed.
+  KOKKOS_INLINE_FUNCTION
+  static value_type to_unit(bits_type const& bits) {
+    return Kokkos::bit_cast<value_type>(
+               (bits >> 12) | bits_type(std::uint64_t(0x3FF0000000000000ULL))) -
+           value_type(1.0);
+  }
+};
+
+// Distributions used by the counter-based fill_random overloads. Each one
+// draws a scalar from a generator and a pack from the first block of a set of
+// lanes, with identical results for the same stream. A block holds
+// values_per_block values: value w of a block is the one drawn after
+// skipping the first w words of the stream.
+template <class Scalar>
+struct Random_UniformDistribution {
+  // Floating point values take one 64-bit word each
+  static constexpr int values_per_block =
+      std::is_floating_point_v<Scalar> ? 2 : 1;
+
+  Scalar start;
+  Scalar end;
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION Scalar operator()(Generator& gen) const {
+    return rand<Generator, Scalar>::draw(gen, start, end);
+  }
+
+  template <class Lanes>
+  KOKKOS_INLINE_FUNCTION typename Lanes::value_type lanes(
+      typename Lanes::bits_type const (&block)[2], int word) const {
+    using value_type = typename Lanes::value_type;
+    return value_type(end - start) * Lanes::to_unit(block[word]) +
+           value_type(start);
+  }
+};
+
+struct Random_NormalDistribution {
+  static constexpr int values_per_block = 1;
+
+  double mean;
+  double std_dev;
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return gen.normal(mean, std_dev);
+  }
+
+  // Box-muller on whole packs
+  template <class Lanes>
+  KOKKOS_INLINE_FUNCTION typename Lanes::value_type lanes(
+      typename Lanes::bits_type const (&block)[2], int /*word*/) const {
+    using value_type      = typename Lanes::value_type;
+    constexpr auto two_pi = 2 * Kokkos::numbers::pi_v<double>;
+
+    const value_type u     = value_type(1.0) - Lanes::to_unit(block[0]);
+    const value_type v     = Lanes::to_unit(block[1]);
+    const value_type r     = Kokkos::sqrt(value_type(-2.0) * Kokkos::log(u));
+    const value_type theta = v * value_type(two_pi);
+    return value_type(mean) + r * Kokkos::cos(theta) * value_type(std_dev);
+  }
+};
+
+struct Random_ExponentialDistribution {
+  static constexpr int values_per_block = 2;
+
+  double rate;
+
+  template <class Generator>
+  KOKKOS_INLINE_FUNCTION double operator()(Generator& gen) const {
+    return gen.exponential(rate);
+  }
+
+  template <class Lanes>
+  KOKKOS_INLINE_FUNCTION typename Lanes::value_type lanes(
+      typename Lanes::bits_type const (&block)[2], int word) const {
+    using value_type = typename Lanes::value_type;
+    return -Kokkos::log(value_type(1.0) - Lanes::to_unit(block[word])) /
+           value_type(rate);
+  }
+};
+
+template <class Abi, class Bijection, class DeviceType, class Distribution>
+KOKKOS_INLINE_FUNCTION Kokkos::Experimental::simd<double, Abi>
+random_counter_based_lanes(
+    const Random_CounterBased_Pool<Bijection, DeviceType>& pool,
+    uint64_t first_stream, uint64_t offset, Distribution const& dist) {
+  using lanes_type = Random_CounterBased_Lanes<Bijection, Abi>;
+  typename lanes_type::bits_type block[2];
+  lanes_type::first_block(pool.seed(), first_stream, offset, block);
+  return dist.template lanes<lanes_type>(block, 0);
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+// Bulk generation for counter-based pools: lane l of the returned pack holds
+// the value that pool.get_state(first_stream + l) would return from its first
+// call to drand(), normal() or exponential() respectively.
+template <class Abi, class Bijection, class DeviceType>
+KOKKOS_INLINE_FUNCTION simd<double, Abi> simd_drand(
+    const Kokkos::Impl::Random_CounterBased_Pool<Bijection, DeviceType>& pool,
+    uint64_t first_stream) {
+  return Kokkos::Impl::random_counter_based_lanes<Abi>(
+      pool, first_stream, 0,
+      Kokkos::Impl::Random_UniformDistribution<double>{0.0, 1.0});
+}
+
+template <class Abi, class Bijection, class DeviceType>
+KOKKOS_INLINE_FUNCTION simd<double, Abi> simd_normal(
+    const Kokkos::Impl::Random_CounterBased_Pool<Bijection, DeviceType>& pool,
+    uint64_t first_stream, double mean = 0.0, double std_dev = 1.0) {
+  return Kokkos::Impl::random_counter_based_lanes<Abi>(
+      pool, first_stream, 0,
+      Kokkos::Impl::Random_NormalDistribution{mean, std_dev});
+}
+
+template <class Abi, class Bijection, class DeviceType>
+KOKKOS_INLINE_FUNCTION simd<double, Abi> simd_exponential(
+    const Kokkos::Impl::Random_CounterBased_Pool<Bijection, DeviceType>& pool,
+    uint64_t first_stream, double rate = 1.0) {
+  return Kokkos::Impl::random_counter_based_lanes<Abi>(
+      pool, first_stream, 0,
+      Kokkos::Impl::Random_ExponentialDistribution{rate});
+}
+
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+using Random_Philox4x32 =
+    Kokkos::Impl::Random_CounterBased<Kokkos::Impl::Random_Philox4x32_10,
+                                      DeviceType>;
+
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+using Random_Philox4x32_Pool =
+    Kokkos::Impl::Random_CounterBased_Pool<Kokkos::Impl::Random_Philox4x32_10,
+                                           DeviceType>;
+
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+using Random_Threefry2x64 =
+    Kokkos::Impl::Random_CounterBased<Kokkos::Impl::Random_Threefry2x64_20,
+                                      DeviceType>;
+
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+using Random_Threefry2x64_Pool = Kokkos::Impl::Random_CounterBased_Pool<
+    Kokkos::Impl::Random_Threefry2x64_20, DeviceType>;
+
+}  // namespace Experimental
+
 namespace Impl {
 
 template <class ViewType, class RandomPool, int loops, int rank,
@@ -1236,9 +1786,10 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 0,
       : a(a_), rand_pool(rand_pool_), begin(begin_), end(end_) {}
 
   KOKKOS_INLINE_FUNCTION
-  void operator()(IndexType) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
-    a()                                     = Rand::draw(gen, begin, end);
+  void operator()(IndexType i) const {
+    typename RandomPool::generator_type gen =
+        Impl::random_pool_get_state(rand_pool, i);
+    a() = Rand::draw(gen, begin, end);
     rand_pool.free_state(gen);
   }
 };
@@ -1260,7 +1811,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 1,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        Impl::random_pool_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0)))
@@ -1287,7 +1839,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 2,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        Impl::random_pool_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1316,7 +1869,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 3,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        Impl::random_pool_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1346,7 +1900,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 4,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        Impl::random_pool_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1377,7 +1932,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 5,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        Impl::random_pool_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1410,7 +1966,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 6,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        Impl::random_pool_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1445,7 +2002,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 7,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        Impl::random_pool_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1482,7 +2040,8 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 8,
 
   KOKKOS_INLINE_FUNCTION
   void operator()(IndexType i) const {
-    typename RandomPool::generator_type gen = rand_pool.get_state();
+    typename RandomPool::generator_type gen =
+        Impl::random_pool_get_state(rand_pool, i);
     for (IndexType j = 0; j < loops; j++) {
       const IndexType idx = i * loops + j;
       if (idx < static_cast<IndexType>(a.extent(0))) {
@@ -1504,19 +2063,132 @@ struct fill_random_functor_begin_end<ViewType, RandomPool, loops, 8,
   }
 };
 
+// Counter-based pools: a fill of N elements uses the first block of the
+// streams 0 to S - 1 at the offset reserved for the fill, where S is N
+// divided by the number of values per block, rounded up. The element with
+// row-major linear index n is value n / S of the block of stream n % S, so
+// the result depends neither on the execution space, nor on the layout of
+// the View, nor on the number of threads.
+template <class ViewType, class RandomPool, class Distribution,
+          class IndexType>
+struct fill_random_counter_based_functor {
+  ViewType a;
+  RandomPool rand_pool;
+  uint64_t offset;
+  IndexType num_streams;
+  Distribution dist;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(IndexType n) const {
+    typename RandomPool::generator_type gen =
+        rand_pool.get_state(n % num_streams, offset);
+    for (IndexType w = n / num_streams; w > 0; --w) gen.urand64();
+    IndexType idx[8] = {};
+    IndexType rem    = n;
+    for (int r = int(ViewType::rank) - 1; r >= 0; --r) {
+      idx[r] = rem % static_cast<IndexType>(a.extent(r));
+      rem /= static_cast<IndexType>(a.extent(r));
+    }
+    a.access(idx[0], idx[1], idx[2], idx[3], idx[4], idx[5], idx[6], idx[7]) =
+        dist(gen);
+  }
+};
+
+// Same mapping as above for Views whose span is traversed in row-major order,
+// processing simd<double, Abi>::size() streams per iteration. Every value of
+// their blocks is stored with a contiguous pack store.
+template <class ViewType, class RandomPool, class Distribution, class Abi,
+          class IndexType>
+struct fill_random_counter_based_simd_functor {
+  using simd_type  = Kokkos::Experimental::simd<double, Abi>;
+  using lanes_type = Random_CounterBased_Lanes<
+      typename RandomPool::generator_type::bijection_type, Abi>;
+
+  ViewType a;
+  RandomPool rand_pool;
+  uint64_t offset;
+  IndexType num_streams;
+  Distribution dist;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(IndexType chunk) const {
+    constexpr IndexType width = simd_type::size();
+    const IndexType first     = chunk * width;
+    const IndexType n         = a.size();
+    typename lanes_type::bits_type block[2];
+    lanes_type::first_block(rand_pool.seed(), first, offset, block);
+    for (int w = 0; w < Distribution::values_per_block; ++w) {
+      const IndexType begin = w * num_streams + first;
+      const IndexType count =
+          Kokkos::min(Kokkos::min(width, num_streams - first), n - begin);
+      if (count <= 0) break;
+      const simd_type x = dist.template lanes<lanes_type>(block, w);
+      double* ptr       = a.data() + begin;
+      if (count == width) {
+        x.copy_to(ptr, Kokkos::Experimental::simd_flag_default);
+      } else {
+        for (IndexType l = 0; l < count; ++l) ptr[l] = x[l];
+      }
+    }
+  }
+};
+
+template <class ExecutionSpace, class ViewType, class RandomPool,
+          class Distribution, class IndexType = int64_t>
+void fill_random_counter_based(const ExecutionSpace& exec, ViewType a,
+                               RandomPool g, Distribution const& dist) {
+  const IndexType n = a.size();
+  if (n == 0) return;
+  const uint64_t offset = g.impl_next_fill_offset();
+  const IndexType num_streams =
+      (n + Distribution::values_per_block - 1) / Distribution::values_per_block;
+  using abi_type = Kokkos::Experimental::simd_abi::ForSpace<ExecutionSpace>;
+  constexpr bool row_major =
+      ViewType::rank <= 1 ||
+      std::is_same_v<typename ViewType::array_layout, LayoutRight>;
+  if constexpr (std::is_same_v<typename ViewType::value_type, double> &&
+                row_major) {
+    if (a.span_is_contiguous()) {
+      constexpr IndexType width =
+          Kokkos::Experimental::simd<double, abi_type>::size();
+      parallel_for(
+          "Kokkos::fill_random",
+          Kokkos::RangePolicy<ExecutionSpace>(exec, 0,
+                                              (num_streams + width - 1) / width),
+          fill_random_counter_based_simd_functor<ViewType, RandomPool,
+                                                 Distribution, abi_type,
+                                                 IndexType>{
+              a, g, offset, num_streams, dist});
+      return;
+    }
+  }
+  parallel_for("Kokkos::fill_random",
+               Kokkos::RangePolicy<ExecutionSpace>(exec, 0, n),
+               fill_random_counter_based_functor<ViewType, RandomPool,
+                                                 Distribution, IndexType>{
+                   a, g, offset, num_streams, dist});
+}
+
 template <class ExecutionSpace, class ViewType, class RandomPool,
           class IndexType = int64_t>
 void fill_random(const ExecutionSpace& exec, ViewType a, RandomPool g,
                  typename ViewType::const_value_type begin,
                  typename ViewType::const_value_type end) {
-  int64_t LDA = a.extent(0);
-  if (LDA > 0)
-    parallel_for(
-        "Kokkos::fill_random",
-        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, (LDA + 127) / 128),
-        Impl::fill_random_functor_begin_end<ViewType, RandomPool, 128,
-                                            ViewType::rank, IndexType>(
-            a, g, begin, end));
+  if constexpr (is_counter_based_random_pool<RandomPool>::value) {
+    fill_random_counter_based(
+        exec, a, g,
+        Random_UniformDistribution<typename ViewType::non_const_value_type>{
+            begin, end});
+  } else {
+    int64_t LDA = a.extent(0);
+    if (LDA > 0)
+      parallel_for(
+          "Kokkos::fill_random",
+          Kokkos::RangePolicy<ExecutionSpace>(exec, 0, (LDA + 127) / 128),
+          Impl::fill_random_functor_begin_end<ViewType, RandomPool, 128,
+                                              ViewType::rank, IndexType>(
+              a, g, begin, end));
+  }
 }
 
 }  // namespace Impl
@@ -1561,6 +2233,46 @@ void fill_random(ViewType a, RandomPool g,
       "fill_random: fence after since no execution space instance provided");
 }
 
+namespace Experimental {
+
+// Fill a floating point View with normally (resp. exponentially) distributed
+// random numbers from a counter-based pool. Contiguous row-major Views of
+// double are filled with simd packs.
+template <class ExecutionSpace, class ViewType, class Bijection,
+          class DeviceType>
+void fill_random_normal(
+    const ExecutionSpace& exec, ViewType a,
+    Kokkos::Impl::Random_CounterBased_Pool<Bijection, DeviceType> g,
+    double mean = 0.0, double std_dev = 1.0) {
+  static_assert(std::is_floating_point_v<typename ViewType::value_type>,
+                "fill_random_normal requires a floating point View");
+  Kokkos::Impl::apply_to_view_of_static_rank(
+      [&](auto dst) {
+        Kokkos::Impl::fill_random_counter_based(
+            exec, dst, g,
+            Kokkos::Impl::Random_NormalDistribution{mean, std_dev});
+      },
+      a);
+}
+
+template <class ExecutionSpace, class ViewType, class Bijection,
+          class DeviceType>
+void fill_random_exponential(
+    const ExecutionSpace& exec, ViewType a,
+    Kokkos::Impl::Random_CounterBased_Pool<Bijection, DeviceType> g,
+    double rate = 1.0) {
+  static_assert(std::is_floating_point_v<typename ViewType::value_type>,
+                "fill_random_exponential requires a floating point View");
+  Kokkos::Impl::apply_to_view_of_static_rank(
+      [&](auto dst) {
+        Kokkos::Impl::fill_random_counter_based(
+            exec, dst, g, Kokkos::Impl::Random_ExponentialDistribution{rate});
+      },
+      a);
+}
+
+}  // namespace Experimental
+
 }  // namespace Kokkos
 
 #ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_RANDOM
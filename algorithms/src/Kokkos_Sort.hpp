@@ -25,6 +25,7 @@
 #include "sorting/Kokkos_SortPublicAPI.hpp"
 #include "sorting/Kokkos_SortByKeyPublicAPI.hpp"
 #include "sorting/Kokkos_NestedSortPublicAPI.hpp"
+#include "sorting/Kokkos_HistogramPublicAPI.hpp"
 
 #ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_SORT
 #undef KOKKOS_IMPL_PUBLIC_INCLUDE
@@ -0,0 +1,123 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SEGMENTED_PUBLIC_API_HPP_
+#define KOKKOS_SEGMENTED_PUBLIC_API_HPP_
+
+#include "impl/Kokkos_MergePathImpl.hpp"
+#include <Kokkos_Core.hpp>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+template <class ExecutionSpace, class RowMapType, class ValuesType,
+          class OutType>
+constexpr void static_assert_segmented_args() {
+  static_assert(Kokkos::is_execution_space_v<ExecutionSpace>,
+                "Kokkos::Experimental segmented algorithms: the first "
+                "argument must be an execution space instance");
+  static_assert(Kokkos::is_view_v<RowMapType> && RowMapType::rank == 1 &&
+                    Kokkos::is_view_v<ValuesType> && ValuesType::rank == 1 &&
+                    Kokkos::is_view_v<OutType> && OutType::rank == 1,
+                "Kokkos::Experimental segmented algorithms: row_map, values "
+                "and out must be rank-1 Views");
+  static_assert(std::is_integral_v<typename RowMapType::value_type>,
+                "Kokkos::Experimental segmented algorithms: row_map must "
+                "hold integral offsets");
+  static_assert(!std::is_const_v<typename OutType::value_type>,
+                "Kokkos::Experimental segmented algorithms: out must not be "
+                "a View of const");
+  static_assert(
+      SpaceAccessibility<ExecutionSpace,
+                         typename RowMapType::memory_space>::accessible &&
+          SpaceAccessibility<ExecutionSpace,
+                             typename ValuesType::memory_space>::accessible &&
+          SpaceAccessibility<ExecutionSpace,
+                             typename OutType::memory_space>::accessible,
+      "Kokkos::Experimental segmented algorithms: execution space instance "
+      "is not able to access the memory space of the View arguments!");
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+// Segment i of a row map holds the entries row_map(i) to row_map(i + 1) - 1
+// of values, as the rows of StaticCrsGraph or Crs do.  The work is split
+// over the threads of exec by rows plus entries, so long segments do not
+// leave threads idle.
+
+// Sets out(i) to the entries of segment i combined in order by op, an
+// associative binary operation.  Empty segments are set to a default
+// constructed value; out must hold at least row_map.extent(0) - 1 values.
+template <class ExecutionSpace, class RowMapType, class ValuesType,
+          class OutType, class BinaryOp>
+void segmented_reduce(const ExecutionSpace& exec, const RowMapType& row_map,
+                      const ValuesType& values, const OutType& out,
+                      const BinaryOp& op) {
+  ::Kokkos::Impl::static_assert_segmented_args<ExecutionSpace, RowMapType,
+                                               ValuesType, OutType>();
+  if (row_map.extent(0) > 1 && out.extent(0) < row_map.extent(0) - 1) {
+    Kokkos::abort(
+        "Kokkos::Experimental::segmented_reduce: out must have one entry per "
+        "segment");
+  }
+  ::Kokkos::Impl::merge_path_segmented<false>(exec, row_map, values, out, op);
+}
+
+template <class ExecutionSpace, class RowMapType, class ValuesType,
+          class OutType>
+void segmented_reduce(const ExecutionSpace& exec, const RowMapType& row_map,
+                      const ValuesType& values, const OutType& out) {
+  using value_type = typename OutType::non_const_value_type;
+  segmented_reduce(exec, row_map, values, out,
+                   ::Kokkos::Impl::SegmentedSumOp<value_type>());
+}
+
+// Sets out(j) for every entry j of a segment to the entries of the segment
+// up to and including j combined in order by op.  out is indexed like
+// values.
+template <class ExecutionSpace, class RowMapType, class ValuesType,
+          class OutType, class BinaryOp>
+void segmented_inclusive_scan(const ExecutionSpace& exec,
+                              const RowMapType& row_map,
+                              const ValuesType& values, const OutType& out,
+                              const BinaryOp& op) {
+  ::Kokkos::Impl::static_assert_segmented_args<ExecutionSpace, RowMapType,
+                                               ValuesType, OutType>();
+  if (out.extent(0) < values.extent(0)) {
+    Kokkos::abort(
+        "Kokkos::Experimental::segmented_inclusive_scan: out must be at "
+        "least as long as values");
+  }
+  ::Kokkos::Impl::merge_path_segmented<true>(exec, row_map, values, out, op);
+}
+
+template <class ExecutionSpace, class RowMapType, class ValuesType,
+          class OutType>
+void segmented_inclusive_scan(const ExecutionSpace& exec,
+                              const RowMapType& row_map,
+                              const ValuesType& values, const OutType& out) {
+  using value_type = typename OutType::non_const_value_type;
+  segmented_inclusive_scan(exec, row_map, values, out,
+                           ::Kokkos::Impl::SegmentedSumOp<value_type>());
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,258 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_MERGE_PATH_IMPL_HPP_
+#define KOKKOS_MERGE_PATH_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+
+// The segmented algorithms walk the merge path of the row ends and the
+// entries of a row map: a row end is taken before the entries that follow
+// it.  The path is cut into chunks of equal length, so every chunk handles
+// the same number of rows plus entries however the entries are spread over
+// the rows.  A row cut by a chunk boundary is finished by a scan over the
+// chunks of the values carried out of each chunk.
+
+namespace Kokkos {
+namespace Impl {
+
+inline constexpr std::size_t merge_path_no_row = ~std::size_t(0);
+
+// A partial result of the row `row`; has_value is false while no entry of
+// the row has been seen.
+template <class ValueType>
+struct MergePathCarry {
+  std::size_t row;
+  bool has_value;
+  ValueType value;
+};
+
+template <class RowMapType>
+struct MergePath {
+  RowMapType row_map;
+  std::size_t num_rows;
+  std::size_t num_chunks;
+
+  KOKKOS_INLINE_FUNCTION
+  std::size_t first_entry() const { return row_map(0); }
+
+  // The entry one past the last one of row, counted from first_entry().
+  KOKKOS_INLINE_FUNCTION
+  std::size_t row_end(std::size_t row) const {
+    return std::size_t(row_map(row + 1)) - first_entry();
+  }
+
+  // Finds the rows and entries consumed before the start of chunk.
+  KOKKOS_INLINE_FUNCTION
+  void chunk_start(std::size_t chunk, std::size_t& row,
+                   std::size_t& entry) const {
+    const std::size_t num_entries = row_end(num_rows - 1);
+    const std::size_t length      = num_rows + num_entries;
+    const std::size_t remainder   = length % num_chunks;
+    const std::size_t diagonal    = chunk * (length / num_chunks) +
+                                 (chunk < remainder ? chunk : remainder);
+    std::size_t lo = diagonal > num_entries ? diagonal - num_entries : 0;
+    std::size_t hi = diagonal < num_rows ? diagonal : num_rows;
+    while (lo < hi) {
+      const std::size_t pivot = lo + (hi - lo) / 2;
+      if (row_end(pivot) <= diagonal - pivot - 1) {
+        lo = pivot + 1;
+      } else {
+        hi = pivot;
+      }
+    }
+    row   = lo;
+    entry = diagonal - lo;
+  }
+};
+
+template <class ValueType, class BinaryOp>
+KOKKOS_INLINE_FUNCTION void merge_path_accumulate(ValueType& partial,
+                                                  bool& has_value,
+                                                  const ValueType& value,
+                                                  const BinaryOp& op) {
+  partial   = has_value ? op(partial, value) : value;
+  has_value = true;
+}
+
+// First pass: every chunk reduces or scans its own entries.  For the
+// reduction the first row finished in the chunk goes to heads since part
+// of it may lie in earlier chunks; the rows after it are written to out.
+// The unfinished row at the end of the chunk goes to tails.
+template <class RowMapType, class ValuesType, class OutType, class BinaryOp,
+          class CarryViewType, bool IsScan>
+struct MergePathChunkFunctor {
+  using accum_type = typename OutType::non_const_value_type;
+
+  MergePath<RowMapType> path;
+  ValuesType values;
+  OutType out;
+  BinaryOp op;
+  CarryViewType heads;
+  CarryViewType tails;
+
+  KOKKOS_FUNCTION
+  void operator()(const std::size_t chunk) const {
+    std::size_t row, entry, last_row, last_entry;
+    path.chunk_start(chunk, row, entry);
+    path.chunk_start(chunk + 1, last_row, last_entry);
+    const std::size_t first_entry = path.first_entry();
+
+    accum_type partial{};
+    bool has_value = false;
+    bool first_row = true;
+    if constexpr (!IsScan) heads(chunk).row = merge_path_no_row;
+    for (; row < last_row; ++row) {
+      const std::size_t row_end = path.row_end(row);
+      for (; entry < row_end; ++entry) {
+        accumulate(partial, has_value, first_entry + entry);
+      }
+      if constexpr (!IsScan) {
+        if (first_row) {
+          heads(chunk) = {row, has_value, partial};
+        } else {
+          out(row) = has_value ? partial : accum_type();
+        }
+      }
+      first_row = false;
+      has_value = false;
+    }
+    for (; entry < last_entry; ++entry) {
+      accumulate(partial, has_value, first_entry + entry);
+    }
+    tails(chunk) = {last_row, has_value, partial};
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void accumulate(accum_type& partial, bool& has_value,
+                  const std::size_t entry) const {
+    merge_path_accumulate(partial, has_value, accum_type(values(entry)), op);
+    if constexpr (IsScan) out(entry) = partial;
+  }
+};
+
+// Second pass: a scan over the chunks of their tails gives every chunk
+// what the earlier chunks hold of the row it starts in.
+template <class RowMapType, class OutType, class BinaryOp, class CarryViewType,
+          bool IsScan>
+struct MergePathFixupFunctor {
+  using accum_type = typename OutType::non_const_value_type;
+  using value_type = MergePathCarry<accum_type>;
+
+  MergePath<RowMapType> path;
+  OutType out;
+  BinaryOp op;
+  CarryViewType heads;
+  CarryViewType tails;
+
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type& carry) const {
+    carry.row       = merge_path_no_row;
+    carry.has_value = false;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type& dst, const value_type& src) const {
+    if (src.row == merge_path_no_row) return;
+    if (src.row != dst.row) {
+      dst = src;
+    } else if (src.has_value) {
+      merge_path_accumulate(dst.value, dst.has_value, src.value, op);
+    }
+  }
+
+  KOKKOS_FUNCTION
+  void operator()(const std::size_t chunk, value_type& prefix,
+                  const bool final) const {
+    if (final) {
+      if constexpr (IsScan) {
+        std::size_t row, entry, last_row, last_entry;
+        path.chunk_start(chunk, row, entry);
+        path.chunk_start(chunk + 1, last_row, last_entry);
+        if (prefix.row == row && prefix.has_value) {
+          const std::size_t first_entry = path.first_entry();
+          const std::size_t row_end =
+              row < last_row ? path.row_end(row) : last_entry;
+          for (entry += first_entry; entry < first_entry + row_end; ++entry) {
+            out(entry) = op(prefix.value, out(entry));
+          }
+        }
+      } else {
+        value_type head = heads(chunk);
+        if (head.row != merge_path_no_row) {
+          if (prefix.row == head.row && prefix.has_value) {
+            head.value =
+                head.has_value ? op(prefix.value, head.value) : prefix.value;
+            head.has_value = true;
+          }
+          out(head.row) = head.has_value ? head.value : accum_type();
+        }
+      }
+    }
+    join(prefix, tails(chunk));
+  }
+};
+
+template <class ValueType>
+struct SegmentedSumOp {
+  KOKKOS_INLINE_FUNCTION
+  ValueType operator()(const ValueType& a, const ValueType& b) const {
+    return a + b;
+  }
+};
+
+template <bool IsScan, class ExecutionSpace, class RowMapType,
+          class ValuesType, class OutType, class BinaryOp>
+void merge_path_segmented(const ExecutionSpace& exec, const RowMapType& row_map,
+                          const ValuesType& values, const OutType& out,
+                          const BinaryOp& op, std::size_t num_chunks = 0) {
+  using accum_type = typename OutType::non_const_value_type;
+  using carry_view_type =
+      Kokkos::View<MergePathCarry<accum_type>*,
+                   Kokkos::Device<ExecutionSpace,
+                                  typename OutType::memory_space>>;
+  using path_type = MergePath<RowMapType>;
+
+  if (row_map.extent(0) <= 1) return;
+
+  // one chunk per thread, the chunks being of equal length
+  if (num_chunks == 0) num_chunks = exec.concurrency();
+  const path_type path{row_map, row_map.extent(0) - 1, num_chunks};
+  carry_view_type heads(
+      view_alloc(exec, WithoutInitializing, "Kokkos::Segmented::heads"),
+      IsScan ? 0 : path.num_chunks);
+  carry_view_type tails(
+      view_alloc(exec, WithoutInitializing, "Kokkos::Segmented::tails"),
+      path.num_chunks);
+  const auto policy = Kokkos::RangePolicy<ExecutionSpace>(
+      exec, std::size_t(0), path.num_chunks);
+
+  Kokkos::parallel_for(
+      "Kokkos::Segmented::Chunks", policy,
+      MergePathChunkFunctor<RowMapType, ValuesType, OutType, BinaryOp,
+                            carry_view_type, IsScan>{path, values, out, op,
+                                                     heads, tails});
+  Kokkos::parallel_scan(
+      "Kokkos::Segmented::Fixup", policy,
+      MergePathFixupFunctor<RowMapType, OutType, BinaryOp, carry_view_type,
+                            IsScan>{path, out, op, heads, tails});
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -19,6 +19,7 @@
 
 #include "Kokkos_BinOpsPublicAPI.hpp"
 #include "impl/Kokkos_CopyOpsForBinSortImpl.hpp"
+#include "impl/Kokkos_HistogramImpl.hpp"
 #include <Kokkos_Core.hpp>
 #include <algorithm>
 
@@ -97,7 +98,6 @@ class BinSort {
   using exec_space  = typename Space::execution_space;
   using bin_op_type = BinSortOp;
 
-  struct bin_count_tag {};
   struct bin_offset_tag {};
   struct bin_binning_tag {};
   struct bin_sort_bins_tag {};
@@ -213,11 +213,13 @@ class BinSort {
         "The provided execution space must be able to access the memory space "
         "BinSort was initialized with!");
 
+    // BinSort is itself a sort, so the counts are never taken by sorting.
     const size_t len = range_end - range_begin;
-    Kokkos::parallel_for(
-        "Kokkos::Sort::BinCount",
-        Kokkos::RangePolicy<ExecutionSpace, bin_count_tag>(exec, 0, len),
-        *this);
+    Impl::histogram_without_sort(
+        exec, keys, range_begin, range_end, bin_op, bin_count_atomic,
+        Impl::select_histogram_strategy<
+            ExecutionSpace, typename Space::memory_space, int>(
+            exec, bin_op.max_bins(), len, false));
     Kokkos::parallel_scan("Kokkos::Sort::BinOffset",
                           Kokkos::RangePolicy<ExecutionSpace, bin_offset_tag>(
                               exec, 0, bin_op.max_bins()),
@@ -352,12 +354,6 @@ class BinSort {
   bin_count_type get_bin_count() const { return bin_count_const; }
 
  public:
-  KOKKOS_INLINE_FUNCTION
-  void operator()(const bin_count_tag& /*tag*/, const int i) const {
-    const int j = range_begin + i;
-    bin_count_atomic(bin_op.bin(keys, j))++;
-  }
-
   KOKKOS_INLINE_FUNCTION
   void operator()(const bin_offset_tag& /*tag*/, const int i,
                   value_type& offset, const bool& final) const {
@@ -0,0 +1,141 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_HISTOGRAM_PUBLIC_API_HPP_
+#define KOKKOS_HISTOGRAM_PUBLIC_API_HPP_
+
+#include "Kokkos_BinOpsPublicAPI.hpp"
+#include "Kokkos_SortPublicAPI.hpp"
+#include "impl/Kokkos_HistogramImpl.hpp"
+#include <Kokkos_Core.hpp>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+template <class ExecutionSpace, class DataViewType, class BinOp,
+          class CountsViewType>
+void histogram_sort_and_count(const ExecutionSpace& exec,
+                              const DataViewType& data, int begin, int end,
+                              const BinOp& bin_op,
+                              const CountsViewType& counts) {
+  using count_type   = typename CountsViewType::non_const_value_type;
+  using memory_space = typename CountsViewType::memory_space;
+  using device_type  = Kokkos::Device<ExecutionSpace, memory_space>;
+  using bins_view_type =
+      Kokkos::View<count_type*, Kokkos::LayoutRight, device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using bin_index_view_type = Kokkos::View<int*, device_type>;
+
+  bins_view_type bins(counts.data(), bin_op.max_bins());
+  bin_index_view_type bin_index(
+      view_alloc(exec, WithoutInitializing, "Kokkos::Histogram::bin_index"),
+      end - begin);
+  const auto policy =
+      Kokkos::RangePolicy<ExecutionSpace>(exec, 0, end - begin);
+
+  Kokkos::parallel_for(
+      "Kokkos::Histogram::BinIndex", policy,
+      HistogramBinIndexFunctor<DataViewType, BinOp, bin_index_view_type>{
+          data, bin_op, bin_index, begin});
+  Kokkos::sort(exec, bin_index);
+  Kokkos::deep_copy(exec, bins, count_type(0));
+  Kokkos::parallel_for(
+      "Kokkos::Histogram::RunLength", policy,
+      HistogramRunLengthFunctor<bin_index_view_type, bins_view_type>{
+          bin_index, bins});
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+// Counts how many elements of data fall in each bin of bin_op, writing the
+// result to the first bin_op.max_bins() entries of counts.  bin_op is used
+// as by BinSort: bin_op.bin(data, i) is the bin of element i.
+//
+// With HistogramStrategy::Automatic, few bins are counted in private bins
+// of every thread, more bins in duplicated copies of the counts as long as
+// the elements outnumber the copies, and otherwise with atomics, or by
+// sorting the bin indices where Kokkos::sort runs in parallel.  Spaces whose
+// memory is not host accessible use atomics.
+template <class ExecutionSpace, class DataType, class... DataProperties,
+          class BinOp, class CountsType, class... CountsProperties>
+void histogram(const ExecutionSpace& exec,
+               const Kokkos::View<DataType, DataProperties...>& data,
+               const BinOp& bin_op,
+               const Kokkos::View<CountsType, CountsProperties...>& counts,
+               HistogramStrategy strategy = HistogramStrategy::Automatic) {
+  using CountsViewType = Kokkos::View<CountsType, CountsProperties...>;
+  using count_type     = typename CountsViewType::value_type;
+  static_assert(
+      CountsViewType::rank == 1 &&
+          (std::is_same_v<typename CountsViewType::array_layout,
+                          LayoutRight> ||
+           std::is_same_v<typename CountsViewType::array_layout, LayoutLeft>),
+      "Kokkos::Experimental::histogram: counts must be a rank-1 View with "
+      "LayoutRight or LayoutLeft");
+  static_assert(std::is_integral_v<count_type> && !std::is_const_v<count_type>,
+                "Kokkos::Experimental::histogram: counts must have a "
+                "non-const integral value type");
+  static_assert(
+      SpaceAccessibility<
+          ExecutionSpace,
+          typename View<DataType, DataProperties...>::memory_space>::
+              accessible &&
+          SpaceAccessibility<ExecutionSpace,
+                             typename CountsViewType::memory_space>::accessible,
+      "Kokkos::Experimental::histogram: execution space instance is not able "
+      "to access the memory space of the View arguments!");
+
+  if (bin_op.max_bins() <= 0 ||
+      counts.extent(0) < static_cast<std::size_t>(bin_op.max_bins())) {
+    Kokkos::abort(
+        "Kokkos::Experimental::histogram: counts must have one entry per bin "
+        "of the BinOp");
+  }
+
+  const int num_elements = data.extent(0);
+  if (strategy == HistogramStrategy::Automatic) {
+    strategy = ::Kokkos::Impl::select_histogram_strategy<
+        ExecutionSpace, typename CountsViewType::memory_space, count_type>(
+        exec, bin_op.max_bins(), num_elements, true);
+  }
+  if (strategy == HistogramStrategy::SortAndCount) {
+    ::Kokkos::Impl::histogram_sort_and_count(exec, data, 0, num_elements,
+                                             bin_op, counts);
+  } else {
+    ::Kokkos::Impl::histogram_without_sort(exec, data, 0, num_elements,
+                                           bin_op, counts, strategy);
+  }
+}
+
+template <class DataType, class... DataProperties, class BinOp,
+          class CountsType, class... CountsProperties>
+void histogram(const Kokkos::View<DataType, DataProperties...>& data,
+               const BinOp& bin_op,
+               const Kokkos::View<CountsType, CountsProperties...>& counts,
+               HistogramStrategy strategy = HistogramStrategy::Automatic) {
+  Kokkos::fence("Kokkos::Experimental::histogram: before");
+  typename Kokkos::View<CountsType, CountsProperties...>::execution_space exec;
+  histogram(exec, data, bin_op, counts, strategy);
+  exec.fence("Kokkos::Experimental::histogram: fence after histogram");
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,250 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_HISTOGRAM_IMPL_HPP_
+#define KOKKOS_HISTOGRAM_IMPL_HPP_
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ScatterView.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+// How Kokkos::Experimental::histogram() counts the elements of each bin.
+enum class HistogramStrategy {
+  // choose from the number of bins, the number of elements and the
+  // concurrency of the execution space
+  Automatic,
+  // every thread counts into bins of its own, merged by the reduction
+  PrivateBins,
+  // every thread counts into its own copy of the counts, as ScatterView
+  // does on the execution space
+  Duplicated,
+  // every element is counted with an atomic increment
+  Atomic,
+  // the bin indices are sorted and the runs of equal indices measured
+  SortAndCount
+};
+
+}  // namespace Experimental
+
+namespace Impl {
+
+template <class ExecutionSpace, class MemorySpace>
+inline constexpr bool histogram_runs_on_host_v =
+    SpaceAccessibility<HostSpace, MemorySpace>::accessible &&
+    SpaceAccessibility<ExecutionSpace, HostSpace>::accessible;
+
+// Private bins are used while they fit in the L1 cache next to the data
+// being read.
+inline constexpr std::size_t histogram_private_bins_max_bytes = 16384;
+
+// Whether Kokkos::sort runs in parallel on ExecutionSpace. It falls back to
+// a serial std::sort on the host execution spaces.
+template <class ExecutionSpace>
+inline constexpr bool histogram_sort_is_parallel_v = false;
+#if defined(KOKKOS_ENABLE_CUDA)
+template <>
+inline constexpr bool histogram_sort_is_parallel_v<Kokkos::Cuda> = true;
+#endif
+#if defined(KOKKOS_ENABLE_HIP)
+template <>
+inline constexpr bool histogram_sort_is_parallel_v<Kokkos::HIP> = true;
+#endif
+#if defined(KOKKOS_ENABLE_SYCL) && defined(KOKKOS_ENABLE_ONEDPL)
+template <>
+inline constexpr bool histogram_sort_is_parallel_v<Kokkos::SYCL> = true;
+#endif
+
+template <class ExecutionSpace, class MemorySpace, class CountType>
+Kokkos::Experimental::HistogramStrategy select_histogram_strategy(
+    const ExecutionSpace& exec, std::size_t num_bins, std::size_t num_elements,
+    bool allow_sort) {
+  using Kokkos::Experimental::HistogramStrategy;
+  if constexpr (!histogram_runs_on_host_v<ExecutionSpace, MemorySpace>) {
+    return HistogramStrategy::Atomic;
+  } else {
+    const std::size_t concurrency = exec.concurrency();
+    if (num_bins * sizeof(CountType) <= histogram_private_bins_max_bytes) {
+      return HistogramStrategy::PrivateBins;
+    }
+    // Resetting and merging the copies costs as much as counting into them.
+    if (num_bins * concurrency <= num_elements) {
+      return HistogramStrategy::Duplicated;
+    }
+    // Sorting the bin indices only pays off when the sort runs in parallel.
+    if (allow_sort && concurrency > 1 &&
+        histogram_sort_is_parallel_v<ExecutionSpace>) {
+      return HistogramStrategy::SortAndCount;
+    }
+    return HistogramStrategy::Atomic;
+  }
+}
+
+template <class DataViewType, class BinOp, class CountType>
+struct HistogramPrivateBinsFunctor {
+  using value_type = CountType[];
+  using size_type  = std::size_t;
+
+  DataViewType data;
+  BinOp bin_op;
+  int begin;
+  size_type value_count;
+
+  HistogramPrivateBinsFunctor(const DataViewType& data_, const BinOp& bin_op_,
+                              int begin_, size_type num_bins)
+      : data(data_), bin_op(bin_op_), begin(begin_), value_count(num_bins) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i, CountType* counts) const {
+    ++counts[bin_op.bin(data, begin + i)];
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void init(CountType* counts) const {
+    for (size_type bin = 0; bin < value_count; ++bin) counts[bin] = 0;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void join(CountType* dst, const CountType* src) const {
+    for (size_type bin = 0; bin < value_count; ++bin) dst[bin] += src[bin];
+  }
+};
+
+template <class DataViewType, class BinOp, class ScatterViewType>
+struct HistogramScatterFunctor {
+  DataViewType data;
+  BinOp bin_op;
+  ScatterViewType counts;
+  int begin;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    auto access = counts.access();
+    access(bin_op.bin(data, begin + i)) += 1;
+  }
+};
+
+template <class DataViewType, class BinOp, class CountsViewType>
+struct HistogramAtomicFunctor {
+  DataViewType data;
+  BinOp bin_op;
+  CountsViewType counts;
+  int begin;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    Kokkos::atomic_inc(&counts(bin_op.bin(data, begin + i)));
+  }
+};
+
+template <class DataViewType, class BinOp, class BinIndexViewType>
+struct HistogramBinIndexFunctor {
+  DataViewType data;
+  BinOp bin_op;
+  BinIndexViewType bin_index;
+  int begin;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    bin_index(i) = bin_op.bin(data, begin + i);
+  }
+};
+
+// Each run of equal sorted bin indices is measured by the thread holding
+// its last element, so every bin is written at most once.
+template <class BinIndexViewType, class CountsViewType>
+struct HistogramRunLengthFunctor {
+  BinIndexViewType bin_index;
+  CountsViewType counts;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int i) const {
+    const int bin = bin_index(i);
+    if (i + 1 < int(bin_index.extent(0)) && bin_index(i + 1) == bin) return;
+    int first = 0;
+    int last  = i;
+    while (first < last) {
+      const int mid = first + (last - first) / 2;
+      if (bin_index(mid) < bin) {
+        first = mid + 1;
+      } else {
+        last = mid;
+      }
+    }
+    counts(bin) = i + 1 - first;
+  }
+};
+
+// Counts the elements [begin, end) of data into the first
+// bin_op.max_bins() entries of counts with any strategy but SortAndCount.
+template <class ExecutionSpace, class DataViewType, class BinOp,
+          class CountsViewType>
+void histogram_without_sort(const ExecutionSpace& exec,
+                            const DataViewType& data, int begin, int end,
+                            const BinOp& bin_op, const CountsViewType& counts,
+                            Kokkos::Experimental::HistogramStrategy strategy) {
+  using Kokkos::Experimental::HistogramStrategy;
+  using count_type   = typename CountsViewType::non_const_value_type;
+  using memory_space = typename CountsViewType::memory_space;
+  using device_type  = Kokkos::Device<ExecutionSpace, memory_space>;
+  using bins_view_type =
+      Kokkos::View<count_type*, Kokkos::LayoutRight, device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  const std::size_t num_bins = bin_op.max_bins();
+  bins_view_type bins(counts.data(), num_bins);
+  const auto policy =
+      Kokkos::RangePolicy<ExecutionSpace>(exec, 0, end - begin);
+
+  switch (strategy) {
+    case HistogramStrategy::PrivateBins: {
+      Kokkos::parallel_reduce(
+          "Kokkos::Histogram::PrivateBins", policy,
+          HistogramPrivateBinsFunctor<DataViewType, BinOp, count_type>(
+              data, bin_op, begin, num_bins),
+          bins);
+      break;
+    }
+    case HistogramStrategy::Duplicated: {
+      using scatter_view_type = Kokkos::Experimental::ScatterView<
+          count_type*, Kokkos::LayoutRight, device_type>;
+      Kokkos::deep_copy(exec, bins, count_type(0));
+      scatter_view_type scatter(exec, bins);
+      Kokkos::parallel_for(
+          "Kokkos::Histogram::Duplicated", policy,
+          HistogramScatterFunctor<DataViewType, BinOp, scatter_view_type>{
+              data, bin_op, scatter, begin});
+      Kokkos::Experimental::contribute(exec, bins, scatter);
+      break;
+    }
+    default: {
+      Kokkos::deep_copy(exec, bins, count_type(0));
+      Kokkos::parallel_for(
+          "Kokkos::Histogram::Atomic", policy,
+          HistogramAtomicFunctor<DataViewType, BinOp, bins_view_type>{
+              data, bin_op, bins, begin});
+      break;
+    }
+  }
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
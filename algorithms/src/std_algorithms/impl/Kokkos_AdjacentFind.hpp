@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_SimdFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -86,10 +87,26 @@ IteratorType adjacent_find_exespace_impl(const std::string& label,
 
   // note that we use below num_elements-1 because
   // each index i in the reduction checks i and (i+1).
-  ::Kokkos::parallel_reduce(
-      label, RangePolicy<ExecutionSpace>(ex, 0, num_elements - 1),
-      // use CTAD
-      StdAdjacentFindFunctor(first, reducer, pred), reducer);
+  bool done = false;
+  if constexpr (can_use_simd_fast_path_v<ExecutionSpace, IteratorType> &&
+                std::is_same_v<PredicateType,
+                               StdAlgoEqualBinaryPredicate<
+                                   typename IteratorType::value_type>>) {
+    if (simd_fast_path_is_contiguous(first)) {
+      using func_t =
+          SimdFastPathFirstPairFunctor<ExecutionSpace, IteratorType, true>;
+      red_result.min_loc_true = simd_fast_path_first_loc(
+          label, ex, func_t::types::num_chunks(num_elements - 1),
+          func_t{&*first, &*first + 1, num_elements - 1});
+      done = true;
+    }
+  }
+  if (!done) {
+    ::Kokkos::parallel_reduce(
+        label, RangePolicy<ExecutionSpace>(ex, 0, num_elements - 1),
+        // use CTAD
+        StdAdjacentFindFunctor(first, reducer, pred), reducer);
+  }
 
   // fence not needed because reducing into scalar
   if (red_result.min_loc_true ==
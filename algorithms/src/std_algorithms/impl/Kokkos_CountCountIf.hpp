@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_SimdFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -65,10 +66,64 @@ typename IteratorType::difference_type count_if_exespace_impl(
   return count;
 }
 
+// simd fast path of count: a chunk counts at most simd_fast_path_chunk_packs
+// matches per lane, so the lanes can count in the value type
+template <class ExecutionSpace, class IteratorType>
+struct StdCountSimdFunctor {
+  using types        = SimdFastPathTypes<ExecutionSpace, IteratorType>;
+  using element_type = typename types::value_type;
+  using simd_type    = typename types::simd_type;
+  using mask_type    = typename types::mask_type;
+  using index_type   = typename IteratorType::difference_type;
+
+  element_type const* m_first;
+  index_type m_num_elements;
+  element_type m_value;
+
+  void operator()(const index_type chunk, index_type& lsum) const {
+    const index_type begin = chunk * index_type(types::chunk);
+    const index_type end =
+        Kokkos::min(begin + index_type(types::chunk), m_num_elements);
+    const simd_type value(m_value);
+    const simd_type one(element_type(1));
+    const simd_type zero(element_type(0));
+    simd_type count(zero);
+    for (index_type i = begin; i < end; i += simd_type::size()) {
+      const std::size_t lanes =
+          Kokkos::min(std::size_t(end - i), simd_type::size());
+      auto found = simd_fast_path_load<simd_type>(m_first + i, lanes) == value;
+      if (lanes < simd_type::size()) {
+        found = found && simd_fast_path_lanes<simd_type>(lanes);
+      }
+      count += condition(found, one, zero);
+    }
+    lsum += index_type(
+        reduce(where(mask_type(true), count), element_type(0), std::plus<>()));
+  }
+};
+
 template <class ExecutionSpace, class IteratorType, class T>
 auto count_exespace_impl(const std::string& label, const ExecutionSpace& ex,
                          IteratorType first, IteratorType last,
                          const T& value) {
+  if constexpr (can_use_simd_fast_path_v<ExecutionSpace, IteratorType> &&
+                std::is_same_v<
+                    T, std::remove_cv_t<typename IteratorType::value_type>>) {
+    Impl::static_assert_random_access_and_accessible(ex, first);
+    Impl::expect_valid_range(first, last);
+    if (first != last && simd_fast_path_is_contiguous(first)) {
+      using func_t = StdCountSimdFunctor<ExecutionSpace, IteratorType>;
+      const auto num_elements = Kokkos::Experimental::distance(first, last);
+      typename IteratorType::difference_type count = 0;
+      ::Kokkos::parallel_reduce(
+          label,
+          RangePolicy<ExecutionSpace>(
+              ex, 0, func_t::types::num_chunks(num_elements)),
+          func_t{&*first, num_elements, value}, count);
+      ex.fence("Kokkos::count: fence after operation");
+      return count;
+    }
+  }
   return count_if_exespace_impl(
       label, ex, first, last,
       ::Kokkos::Experimental::Impl::StdAlgoEqualsValUnaryPredicate<T>(value));
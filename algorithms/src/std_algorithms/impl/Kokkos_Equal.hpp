@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_SimdFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -65,7 +66,24 @@ bool equal_exespace_impl(const std::string& label, const ExecutionSpace& ex,
 
   // run
   const auto num_elements = Kokkos::Experimental::distance(first1, last1);
-  std::size_t different   = 0;
+  if constexpr (can_use_simd_fast_path_v<ExecutionSpace, IteratorType1,
+                                         IteratorType2> &&
+                std::is_same_v<BinaryPredicateType,
+                               StdAlgoEqualBinaryPredicate<
+                                   typename IteratorType1::value_type,
+                                   typename IteratorType2::value_type>>) {
+    if (num_elements > 0 && simd_fast_path_is_contiguous(first1) &&
+        simd_fast_path_is_contiguous(first2)) {
+      using func_t = SimdFastPathFirstPairFunctor<ExecutionSpace,
+                                                  IteratorType1, false>;
+      using index_type = typename IteratorType1::difference_type;
+      return simd_fast_path_first_loc(
+                 label, ex, func_t::types::num_chunks(num_elements),
+                 func_t{&*first1, &*first2, num_elements}) ==
+             ::Kokkos::reduction_identity<index_type>::min();
+    }
+  }
+  std::size_t different = 0;
   ::Kokkos::parallel_reduce(
       label, RangePolicy<ExecutionSpace>(ex, 0, num_elements),
       StdEqualFunctor(first1, first2, predicate), different);
@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_SimdFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -107,10 +108,59 @@ IteratorType find_if_or_not_exespace_impl(const std::string& label,
   }
 }
 
+// simd fast path of find: each chunk stops at its first match
+template <class ExecutionSpace, class IteratorType>
+struct StdFindSimdFunctor {
+  using types          = SimdFastPathTypes<ExecutionSpace, IteratorType>;
+  using element_type   = typename types::value_type;
+  using simd_type      = typename types::simd_type;
+  using index_type     = typename IteratorType::difference_type;
+  using red_value_type = FirstLocScalar<index_type>;
+
+  element_type const* m_first;
+  index_type m_num_elements;
+  element_type m_value;
+
+  void operator()(const index_type chunk, red_value_type& red_value) const {
+    const index_type begin = chunk * index_type(types::chunk);
+    const index_type end =
+        Kokkos::min(begin + index_type(types::chunk), m_num_elements);
+    const index_type loc =
+        simd_fast_path_find<simd_type>(m_first, begin, end, m_value);
+    if (loc != end) {
+      red_value.min_loc_true = Kokkos::min(red_value.min_loc_true, loc);
+    }
+  }
+};
+
+template <class ExecutionSpace, class IteratorType>
+IteratorType find_simd_exespace_impl(
+    const std::string& label, const ExecutionSpace& ex, IteratorType first,
+    IteratorType last,
+    const std::remove_cv_t<typename IteratorType::value_type>& value) {
+  using func_t     = StdFindSimdFunctor<ExecutionSpace, IteratorType>;
+  using index_type = typename IteratorType::difference_type;
+  const auto num_elements = Kokkos::Experimental::distance(first, last);
+  const index_type loc    = simd_fast_path_first_loc(
+      label, ex, func_t::types::num_chunks(num_elements),
+      func_t{&*first, num_elements, value});
+  return loc == ::Kokkos::reduction_identity<index_type>::min() ? last
+                                                                : first + loc;
+}
+
 template <class ExecutionSpace, class InputIterator, class T>
 InputIterator find_exespace_impl(const std::string& label, ExecutionSpace ex,
                                  InputIterator first, InputIterator last,
                                  const T& value) {
+  if constexpr (can_use_simd_fast_path_v<ExecutionSpace, InputIterator> &&
+                std::is_same_v<
+                    T, std::remove_cv_t<typename InputIterator::value_type>>) {
+    Impl::static_assert_random_access_and_accessible(ex, first);
+    Impl::expect_valid_range(first, last);
+    if (first != last && simd_fast_path_is_contiguous(first)) {
+      return find_simd_exespace_impl(label, ex, first, last, value);
+    }
+  }
   return find_if_or_not_exespace_impl<true>(
       label, ex, first, last,
       ::Kokkos::Experimental::Impl::StdAlgoEqualsValUnaryPredicate<T>(value));
@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_SimdFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -63,6 +64,103 @@ struct StdMinMaxElemFunctor {
       : m_first(std::move(first)), m_reducer(std::move(reducer)) {}
 };
 
+// simd fast paths of min_element, max_element and minmax_element: the
+// extrema of a chunk are found lane-wise, then located by a search for their
+// first (last for the maximum of minmax_element) occurrence. A chunk whose
+// extremum is not found again, because of NaNs, is joined element-wise.
+template <class ExecutionSpace, class IteratorType, class ReducerType,
+          bool IsMax>
+struct StdMinOrMaxElemSimdFunctor {
+  using types          = SimdFastPathTypes<ExecutionSpace, IteratorType>;
+  using element_type   = typename types::value_type;
+  using simd_type      = typename types::simd_type;
+  using index_type     = typename IteratorType::difference_type;
+  using red_value_type = typename ReducerType::value_type;
+
+  element_type const* m_first;
+  index_type m_num_elements;
+  ReducerType m_reducer;
+
+  void operator()(const index_type chunk, red_value_type& red_value) const {
+    const index_type begin = chunk * index_type(types::chunk);
+    const index_type end =
+        Kokkos::min(begin + index_type(types::chunk), m_num_elements);
+    simd_type best(m_first[begin]);
+    for (index_type i = begin; i < end; i += simd_type::size()) {
+      const std::size_t lanes =
+          Kokkos::min(std::size_t(end - i), simd_type::size());
+      const auto v =
+          simd_fast_path_load<simd_type>(m_first + i, lanes, m_first[begin]);
+      if constexpr (IsMax) {
+        best = condition(best < v, v, best);
+      } else {
+        best = condition(v < best, v, best);
+      }
+    }
+    element_type val = best[0];
+    for (std::size_t lane = 1; lane < simd_type::size(); ++lane) {
+      if (IsMax ? val < best[lane] : best[lane] < val) val = best[lane];
+    }
+    const index_type loc =
+        simd_fast_path_find<simd_type>(m_first, begin, end, val);
+    if (loc != end) {
+      m_reducer.join(red_value, red_value_type{val, loc});
+    } else {
+      for (index_type i = begin; i < end; ++i) {
+        m_reducer.join(red_value, red_value_type{m_first[i], i});
+      }
+    }
+  }
+};
+
+template <class ExecutionSpace, class IteratorType, class ReducerType>
+struct StdMinMaxElemSimdFunctor {
+  using types          = SimdFastPathTypes<ExecutionSpace, IteratorType>;
+  using element_type   = typename types::value_type;
+  using simd_type      = typename types::simd_type;
+  using index_type     = typename IteratorType::difference_type;
+  using red_value_type = typename ReducerType::value_type;
+
+  element_type const* m_first;
+  index_type m_num_elements;
+  ReducerType m_reducer;
+
+  void operator()(const index_type chunk, red_value_type& red_value) const {
+    const index_type begin = chunk * index_type(types::chunk);
+    const index_type end =
+        Kokkos::min(begin + index_type(types::chunk), m_num_elements);
+    simd_type min(m_first[begin]);
+    simd_type max(m_first[begin]);
+    for (index_type i = begin; i < end; i += simd_type::size()) {
+      const std::size_t lanes =
+          Kokkos::min(std::size_t(end - i), simd_type::size());
+      const auto v =
+          simd_fast_path_load<simd_type>(m_first + i, lanes, m_first[begin]);
+      min = condition(v < min, v, min);
+      max = condition(max < v, v, max);
+    }
+    element_type min_val = min[0];
+    element_type max_val = max[0];
+    for (std::size_t lane = 1; lane < simd_type::size(); ++lane) {
+      if (min[lane] < min_val) min_val = min[lane];
+      if (max_val < max[lane]) max_val = max[lane];
+    }
+    const index_type min_loc =
+        simd_fast_path_find<simd_type>(m_first, begin, end, min_val);
+    const index_type max_loc =
+        simd_fast_path_find_last<simd_type>(m_first, begin, end, max_val);
+    if (min_loc != end && max_loc != end) {
+      m_reducer.join(red_value,
+                     red_value_type{min_val, max_val, min_loc, max_loc});
+    } else {
+      for (index_type i = begin; i < end; ++i) {
+        const auto& my_value = m_first[i];
+        m_reducer.join(red_value, red_value_type{my_value, my_value, i, i});
+      }
+    }
+  }
+};
+
 //
 // exespace impl
 //
@@ -92,6 +190,24 @@ IteratorType min_or_max_element_exespace_impl(const std::string& label,
   reduction_value_type red_result;
   reducer_type reducer(red_result, std::forward<Args>(args)...);
   const auto num_elements = Kokkos::Experimental::distance(first, last);
+  constexpr bool is_min = std::is_same_v<
+      reducer_type, ::Kokkos::MinFirstLoc<value_type, index_type>>;
+  constexpr bool is_max = std::is_same_v<
+      reducer_type, ::Kokkos::MaxFirstLoc<value_type, index_type>>;
+  if constexpr (can_use_simd_fast_path_v<ExecutionSpace, IteratorType> &&
+                (is_min || is_max)) {
+    if (simd_fast_path_is_contiguous(first)) {
+      using simd_func_t = StdMinOrMaxElemSimdFunctor<ExecutionSpace,
+                                                     IteratorType,
+                                                     reducer_type, is_max>;
+      ::Kokkos::parallel_reduce(
+          label,
+          RangePolicy<ExecutionSpace>(
+              ex, 0, simd_func_t::types::num_chunks(num_elements)),
+          simd_func_t{&*first, num_elements, reducer}, reducer);
+      return first + red_result.loc;
+    }
+  }
   ::Kokkos::parallel_reduce(label,
                             RangePolicy<ExecutionSpace>(ex, 0, num_elements),
                             func_t(first, reducer), reducer);
@@ -126,6 +242,21 @@ template <template <class... Args> class ReducerType, class ExecutionSpace,
   reduction_value_type red_result;
   reducer_type reducer(red_result, std::forward<Args>(args)...);
   const auto num_elements = Kokkos::Experimental::distance(first, last);
+  if constexpr (can_use_simd_fast_path_v<ExecutionSpace, IteratorType> &&
+                std::is_same_v<reducer_type,
+                               ::Kokkos::MinMaxFirstLastLoc<value_type,
+                                                            index_type>>) {
+    if (simd_fast_path_is_contiguous(first)) {
+      using simd_func_t =
+          StdMinMaxElemSimdFunctor<ExecutionSpace, IteratorType, reducer_type>;
+      ::Kokkos::parallel_reduce(
+          label,
+          RangePolicy<ExecutionSpace>(
+              ex, 0, simd_func_t::types::num_chunks(num_elements)),
+          simd_func_t{&*first, num_elements, reducer}, reducer);
+      return {first + red_result.min_loc, first + red_result.max_loc};
+    }
+  }
   ::Kokkos::parallel_reduce(label,
                             RangePolicy<ExecutionSpace>(ex, 0, num_elements),
                             func_t(first, reducer), reducer);
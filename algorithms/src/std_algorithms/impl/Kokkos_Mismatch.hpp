@@ -20,6 +20,7 @@
 #include <Kokkos_Core.hpp>
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
+#include "Kokkos_SimdFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -95,11 +96,30 @@ template <class ExecutionSpace, class IteratorType1, class IteratorType2,
   const auto num_elemen_par_reduce = (num_e1 <= num_e2) ? num_e1 : num_e2;
   reduction_value_type red_result;
   reducer_type reducer(red_result);
-  ::Kokkos::parallel_reduce(
-      label, RangePolicy<ExecutionSpace>(ex, 0, num_elemen_par_reduce),
-      // use CTAD
-      StdMismatchRedFunctor(first1, first2, reducer, std::move(predicate)),
-      reducer);
+  bool done = false;
+  if constexpr (can_use_simd_fast_path_v<ExecutionSpace, IteratorType1,
+                                         IteratorType2> &&
+                std::is_same_v<BinaryPredicateType,
+                               StdAlgoEqualBinaryPredicate<
+                                   typename IteratorType1::value_type,
+                                   typename IteratorType2::value_type>>) {
+    if (simd_fast_path_is_contiguous(first1) &&
+        simd_fast_path_is_contiguous(first2)) {
+      using func_t = SimdFastPathFirstPairFunctor<ExecutionSpace,
+                                                  IteratorType1, false>;
+      red_result.min_loc_true = simd_fast_path_first_loc(
+          label, ex, func_t::types::num_chunks(num_elemen_par_reduce),
+          func_t{&*first1, &*first2, num_elemen_par_reduce});
+      done = true;
+    }
+  }
+  if (!done) {
+    ::Kokkos::parallel_reduce(
+        label, RangePolicy<ExecutionSpace>(ex, 0, num_elemen_par_reduce),
+        // use CTAD
+        StdMismatchRedFunctor(first1, first2, reducer, std::move(predicate)),
+        reducer);
+  }
 
   // fence not needed because reducing into scalar
 
@@ -21,6 +21,7 @@
 #include "Kokkos_Constraints.hpp"
 #include "Kokkos_HelperPredicates.hpp"
 #include "Kokkos_ReducerWithArbitraryJoinerNoNeutralElement.hpp"
+#include "Kokkos_SimdFastPath.hpp"
 #include <std_algorithms/Kokkos_Distance.hpp>
 #include <string>
 
@@ -40,6 +41,34 @@ struct StdReduceDefaultFunctor {
   }
 };
 
+// simd fast path of the default reduce: the sum of a chunk is accumulated
+// lane-wise and reduced horizontally once
+template <class ExecutionSpace, class IteratorType>
+struct StdReduceDefaultSimdFunctor {
+  using types        = SimdFastPathTypes<ExecutionSpace, IteratorType>;
+  using element_type = typename types::value_type;
+  using simd_type    = typename types::simd_type;
+  using mask_type    = typename types::mask_type;
+  using index_type   = typename IteratorType::difference_type;
+
+  element_type const* m_first;
+  index_type m_num_elements;
+
+  void operator()(const index_type chunk, element_type& update) const {
+    const index_type begin = chunk * index_type(types::chunk);
+    const index_type end =
+        Kokkos::min(begin + index_type(types::chunk), m_num_elements);
+    simd_type sum(element_type(0));
+    for (index_type i = begin; i < end; i += simd_type::size()) {
+      const std::size_t lanes =
+          Kokkos::min(std::size_t(end - i), simd_type::size());
+      sum += simd_fast_path_load<simd_type>(m_first + i, lanes);
+    }
+    update +=
+        reduce(where(mask_type(true), sum), element_type(0), std::plus<>());
+  }
+};
+
 template <class ValueType>
 struct StdReduceDefaultJoinFunctor {
   KOKKOS_FUNCTION
@@ -138,6 +167,22 @@ ValueType reduce_default_functors_exespace_impl(
     // run
     value_type tmp;
     const auto num_elements = Kokkos::Experimental::distance(first, last);
+    if constexpr (can_use_simd_fast_path_v<ExecutionSpace, IteratorType> &&
+                  std::is_same_v<value_type,
+                                 std::remove_cv_t<
+                                     typename IteratorType::value_type>>) {
+      if (simd_fast_path_is_contiguous(first)) {
+        using simd_functor_type =
+            Impl::StdReduceDefaultSimdFunctor<ExecutionSpace, IteratorType>;
+        ::Kokkos::parallel_reduce(
+            label,
+            RangePolicy<ExecutionSpace>(
+                ex, 0, simd_functor_type::types::num_chunks(num_elements)),
+            simd_functor_type{&*first, num_elements}, tmp);
+        tmp += init_reduction_value;
+        return tmp;
+      }
+    }
     ::Kokkos::parallel_reduce(label,
                               RangePolicy<ExecutionSpace>(ex, 0, num_elements),
                               functor_type{first}, tmp);
@@ -0,0 +1,249 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_STD_ALGORITHMS_SIMD_FAST_PATH_HPP
+#define KOKKOS_STD_ALGORITHMS_SIMD_FAST_PATH_HPP
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+#include "Kokkos_Constraints.hpp"
+#include <string>
+#include <type_traits>
+
+// Helpers for the simd fast paths of the exespace algorithms that compare
+// or reduce the elements of contiguous arithmetic Views with the default
+// predicates. Each parallel iteration handles a chunk of
+// simd_fast_path_chunk_packs packs, so that the per-element work is plain
+// simd compares and the horizontal reductions happen once per chunk.
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+inline constexpr std::size_t simd_fast_path_chunk_packs = 32;
+
+template <class ExecutionSpace>
+using simd_fast_path_abi_t =
+    typename simd_abi::Impl::ForSpace<ExecutionSpace>::type;
+
+template <class T>
+using simd_fast_path_complete_t = decltype(sizeof(T));
+
+template <class ExecutionSpace, class ValueType, class = void>
+struct simd_fast_path_available : std::false_type {};
+
+// only for execution spaces with a vector Abi and value types it supports
+template <class ExecutionSpace, class ValueType>
+struct simd_fast_path_available<
+    ExecutionSpace, ValueType,
+    std::void_t<simd_fast_path_abi_t<ExecutionSpace>>> {
+  using abi_type = simd_fast_path_abi_t<ExecutionSpace>;
+  static constexpr bool value =
+      !std::is_same_v<abi_type, simd_abi::scalar> &&
+      std::is_arithmetic_v<ValueType> && !std::is_same_v<ValueType, bool> &&
+      Kokkos::is_detected<simd_fast_path_complete_t,
+                          simd<ValueType, abi_type>>::value;
+};
+
+// true if the fast paths apply to the iterators, which must be Kokkos
+// iterators of the same arithmetic value type; the elements must still be
+// checked to be contiguous with simd_fast_path_is_contiguous
+template <class ExecutionSpace, class IteratorType, class... IteratorTypes>
+inline constexpr bool can_use_simd_fast_path_v = []() {
+  if constexpr ((is_kokkos_iterator_v<IteratorType> && ... &&
+                 is_kokkos_iterator_v<IteratorTypes>)) {
+    using value_type = std::remove_cv_t<typename IteratorType::value_type>;
+    return (std::is_same_v<
+                value_type,
+                std::remove_cv_t<typename IteratorTypes::value_type>> &&
+            ...) &&
+           simd_fast_path_available<ExecutionSpace, value_type>::value;
+  } else {
+    return false;
+  }
+}();
+
+template <class IteratorType>
+bool simd_fast_path_is_contiguous(IteratorType const& it) {
+  return it.view().stride(0) == 1;
+}
+
+template <class ExecutionSpace, class IteratorType>
+struct SimdFastPathTypes {
+  using value_type = std::remove_cv_t<typename IteratorType::value_type>;
+  using abi_type   = simd_fast_path_abi_t<ExecutionSpace>;
+  using simd_type  = simd<value_type, abi_type>;
+  using mask_type  = typename simd_type::mask_type;
+
+  // elements per chunk
+  static constexpr std::size_t chunk =
+      simd_fast_path_chunk_packs * simd_type::size();
+
+  template <class IndexType>
+  static IndexType num_chunks(IndexType num_elements) {
+    return (num_elements + IndexType(chunk) - 1) / IndexType(chunk);
+  }
+};
+
+template <class SimdType>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION typename SimdType::mask_type
+simd_fast_path_lanes(std::size_t lanes) {
+  return typename SimdType::mask_type(
+      [&](std::size_t lane) { return lane < lanes; });
+}
+
+// the first lanes elements at ptr, the others fill
+template <class SimdType>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION SimdType simd_fast_path_load(
+    typename SimdType::value_type const* ptr, std::size_t lanes,
+    typename SimdType::value_type fill = 0) {
+  if (lanes == SimdType::size()) {
+    SimdType result;
+    result.copy_from(ptr, simd_flag_default);
+    return result;
+  }
+  SimdType result(fill);
+  where(simd_fast_path_lanes<SimdType>(lanes), result)
+      .copy_from(ptr, simd_flag_default);
+  return result;
+}
+
+template <class MaskType>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::size_t simd_fast_path_first_lane(
+    MaskType const& mask) {
+  std::size_t lane = 0;
+  while (!mask[lane]) ++lane;
+  return lane;
+}
+
+template <class MaskType>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION std::size_t simd_fast_path_last_lane(
+    MaskType const& mask) {
+  std::size_t lane = MaskType::size() - 1;
+  while (!mask[lane]) --lane;
+  return lane;
+}
+
+// the first i in [begin, end) with ptr[i] == value, or end
+template <class SimdType, class IndexType>
+IndexType simd_fast_path_find(typename SimdType::value_type const* ptr,
+                              IndexType begin, IndexType end,
+                              typename SimdType::value_type value) {
+  const SimdType simd_value(value);
+  for (IndexType i = begin; i < end; i += SimdType::size()) {
+    const std::size_t lanes =
+        Kokkos::min(std::size_t(end - i), SimdType::size());
+    auto found = simd_fast_path_load<SimdType>(ptr + i, lanes) == simd_value;
+    if (lanes < SimdType::size()) {
+      found = found && simd_fast_path_lanes<SimdType>(lanes);
+    }
+    if (any_of(found)) return i + IndexType(simd_fast_path_first_lane(found));
+  }
+  return end;
+}
+
+// the last i in [begin, end) with ptr[i] == value, or end
+template <class SimdType, class IndexType>
+IndexType simd_fast_path_find_last(typename SimdType::value_type const* ptr,
+                                   IndexType begin, IndexType end,
+                                   typename SimdType::value_type value) {
+  const SimdType simd_value(value);
+  const IndexType width = SimdType::size();
+  for (IndexType i = begin + (end - begin - 1) / width * width; i >= begin;
+       i -= width) {
+    const std::size_t lanes =
+        Kokkos::min(std::size_t(end - i), std::size_t(width));
+    auto found = simd_fast_path_load<SimdType>(ptr + i, lanes) == simd_value;
+    if (lanes < SimdType::size()) {
+      found = found && simd_fast_path_lanes<SimdType>(lanes);
+    }
+    if (any_of(found)) return i + IndexType(simd_fast_path_last_lane(found));
+  }
+  return end;
+}
+
+// Runs functor(chunk, FirstLocScalar&) over blocks of chunks of doubling
+// size and returns the first location any block found, or the reduction
+// identity. An early match is found after scanning a small prefix rather
+// than the whole range.
+template <class ExecutionSpace, class IndexType, class FunctorType>
+IndexType simd_fast_path_first_loc(const std::string& label,
+                                   const ExecutionSpace& ex,
+                                   IndexType num_chunks,
+                                   FunctorType const& functor) {
+  using reducer_type         = FirstLoc<IndexType>;
+  using reduction_value_type = typename reducer_type::value_type;
+  IndexType block = Kokkos::max(IndexType(ex.concurrency()), IndexType(1));
+  for (IndexType begin = 0; begin < num_chunks;) {
+    IndexType const end = Kokkos::min(num_chunks, begin + block);
+    reduction_value_type red_result;
+    reducer_type reducer(red_result);
+    ::Kokkos::parallel_reduce(label,
+                              RangePolicy<ExecutionSpace>(ex, begin, end),
+                              functor, reducer);
+    if (red_result.min_loc_true !=
+        ::Kokkos::reduction_identity<IndexType>::min()) {
+      return red_result.min_loc_true;
+    }
+    begin = end;
+    block *= 2;
+  }
+  return ::Kokkos::reduction_identity<IndexType>::min();
+}
+
+// Finds the first i of a chunk for which first1[i] == first2[i] is FindEqual,
+// for FirstLoc reductions. Not equal is computed as !(a == b) so that NaNs
+// compare as with the scalar predicates.
+template <class ExecutionSpace, class IteratorType, bool FindEqual>
+struct SimdFastPathFirstPairFunctor {
+  using types          = SimdFastPathTypes<ExecutionSpace, IteratorType>;
+  using element_type   = typename types::value_type;
+  using simd_type      = typename types::simd_type;
+  using index_type     = typename IteratorType::difference_type;
+  using red_value_type = FirstLocScalar<index_type>;
+
+  element_type const* m_first1;
+  element_type const* m_first2;
+  index_type m_num_elements;
+
+  void operator()(const index_type chunk, red_value_type& red_value) const {
+    const index_type begin = chunk * index_type(types::chunk);
+    const index_type end =
+        Kokkos::min(begin + index_type(types::chunk), m_num_elements);
+    for (index_type i = begin; i < end; i += simd_type::size()) {
+      const std::size_t lanes =
+          Kokkos::min(std::size_t(end - i), simd_type::size());
+      auto found = simd_fast_path_load<simd_type>(m_first1 + i, lanes) ==
+                   simd_fast_path_load<simd_type>(m_first2 + i, lanes);
+      if constexpr (!FindEqual) found = !found;
+      if (lanes < simd_type::size()) {
+        found = found && simd_fast_path_lanes<simd_type>(lanes);
+      }
+      if (any_of(found)) {
+        red_value.min_loc_true = Kokkos::min(
+            red_value.min_loc_true,
+            index_type(i + simd_fast_path_first_lane(found)));
+        return;
+      }
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
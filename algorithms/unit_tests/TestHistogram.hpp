@@ -0,0 +1,108 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_ALGORITHMS_UNITTESTS_TEST_HISTOGRAM_HPP
+#define KOKKOS_ALGORITHMS_UNITTESTS_TEST_HISTOGRAM_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <Kokkos_Sort.hpp>
+#include <vector>
+
+namespace Test {
+namespace Histogram {
+
+template <class ExecutionSpace, class CountType>
+void test_histogram(int n, int max_bin,
+                    Kokkos::Experimental::HistogramStrategy strategy) {
+  using KeyViewType = Kokkos::View<int*, ExecutionSpace>;
+  KeyViewType keys("keys", n);
+  Kokkos::Random_XorShift64_Pool<ExecutionSpace> g(1931);
+  Kokkos::fill_random(keys, g, max_bin + 1);
+
+  // one bin per value: BinOp1D adds a bin for the maximum
+  Kokkos::BinOp1D<KeyViewType> bin_op(max_bin, 0, max_bin);
+  const int num_bins = bin_op.max_bins();
+
+  // counts has more entries than bins, those must be left alone
+  Kokkos::View<CountType*, ExecutionSpace> counts("counts", num_bins + 1);
+  Kokkos::deep_copy(counts, CountType(7));
+  ExecutionSpace exec;
+  Kokkos::Experimental::histogram(exec, keys, bin_op, counts, strategy);
+
+  auto keys_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), keys);
+  auto counts_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts);
+  std::vector<CountType> expected(num_bins, 0);
+  for (int i = 0; i < n; ++i) ++expected[keys_h(i)];
+  for (int bin = 0; bin < num_bins; ++bin) {
+    ASSERT_EQ(counts_h(bin), expected[bin]) << "bin " << bin;
+  }
+  ASSERT_EQ(counts_h(num_bins), CountType(7));
+}
+
+template <class ExecutionSpace>
+void test_histogram_all_strategies(int n, int max_bin) {
+  using Kokkos::Experimental::HistogramStrategy;
+  for (auto strategy :
+       {HistogramStrategy::Automatic, HistogramStrategy::PrivateBins,
+        HistogramStrategy::Duplicated, HistogramStrategy::Atomic,
+        HistogramStrategy::SortAndCount}) {
+    test_histogram<ExecutionSpace, int>(n, max_bin, strategy);
+    test_histogram<ExecutionSpace, unsigned long>(n, max_bin, strategy);
+  }
+}
+
+}  // namespace Histogram
+
+TEST(TEST_CATEGORY, Histogram) {
+  // few bins, more bins than fit in private bins, more bins than elements
+  Histogram::test_histogram_all_strategies<TEST_EXECSPACE>(10000, 15);
+  Histogram::test_histogram_all_strategies<TEST_EXECSPACE>(100000, 9000);
+  Histogram::test_histogram_all_strategies<TEST_EXECSPACE>(1000, 200000);
+  Histogram::test_histogram_all_strategies<TEST_EXECSPACE>(0, 10);
+}
+
+TEST(TEST_CATEGORY, Histogram_3D) {
+  using KeyViewType = Kokkos::View<double* [3], TEST_EXECSPACE>;
+  KeyViewType keys("keys", 4096);
+  Kokkos::Random_XorShift64_Pool<TEST_EXECSPACE> g(1931);
+  Kokkos::fill_random(keys, g, 100.0);
+
+  int bin_max[3] = {4, 4, 4};
+  double min[3]  = {0, 0, 0};
+  double max[3]  = {100, 100, 100};
+  using BinOp    = Kokkos::BinOp3D<KeyViewType>;
+  BinOp bin_op(bin_max, min, max);
+
+  Kokkos::View<int*, TEST_EXECSPACE> counts("counts", bin_op.max_bins());
+  Kokkos::Experimental::histogram(keys, bin_op, counts);
+
+  auto keys_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), keys);
+  auto counts_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts);
+  std::vector<int> expected(bin_op.max_bins(), 0);
+  for (int i = 0; i < int(keys_h.extent(0)); ++i) {
+    ++expected[bin_op.bin(keys_h, i)];
+  }
+  for (int bin = 0; bin < bin_op.max_bins(); ++bin) {
+    ASSERT_EQ(counts_h(bin), expected[bin]) << "bin " << bin;
+  }
+}
+
+}  // namespace Test
+#endif
@@ -117,10 +117,10 @@ struct test_random_functor {
         density_3d(d3d) {}
 
   KOKKOS_INLINE_FUNCTION
-  void operator()(int /*i*/, RandomProperties& prop) const {
+  void operator()(int i, RandomProperties& prop) const {
     using Kokkos::atomic_fetch_add;
 
-    rnd_type rand_gen = rand_pool.get_state();
+    rnd_type rand_gen = Kokkos::Impl::random_pool_get_state(rand_pool, i);
     for (int k = 0; k < 1024; ++k) {
       const Scalar tmp = Kokkos::rand<rnd_type, Scalar>::draw(rand_gen);
       prop.count++;
@@ -485,7 +485,8 @@ struct generate_random_stream {
 
   KOKKOS_INLINE_FUNCTION
   void operator()(int i) const {
-    typename GeneratorPool::generator_type rand_gen = rand_pool.get_state();
+    typename GeneratorPool::generator_type rand_gen =
+        Kokkos::Impl::random_pool_get_state(rand_pool, i);
 
     for (int k = 0; k < samples; k++) vals(i, k) = rand_gen.urand64();
 
@@ -539,8 +540,204 @@ void test_duplicate_stream() {
   }
 }
 
+template <class ExecutionSpace, class Pool>
+void test_counter_based_reproducible() {
+  using ViewType = Kokkos::View<double**, ExecutionSpace>;
+
+  const int n = 1000;
+  const int m = 17;
+  Pool pool(31415);
+
+  // Successive fills from a pool draw different numbers
+  ViewType a("A", n, m);
+  ViewType b("B", n, m);
+  Kokkos::fill_random(ExecutionSpace{}, a, pool, -1., 1.);
+  Kokkos::fill_random(ExecutionSpace{}, b, pool, -1., 1.);
+
+  // Counter-based pools must produce the same numbers regardless of how the
+  // iterations are distributed over threads
+  Pool same(31415);
+  Kokkos::View<double**, Kokkos::HostSpace> c("C", n, m);
+  Kokkos::fill_random(Kokkos::DefaultHostExecutionSpace{}, c, same, -1., 1.);
+  Kokkos::fence();
+
+  auto a_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, a);
+  auto b_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, b);
+  int equal = 0;
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < m; ++j) {
+      equal += a_h(i, j) == b_h(i, j);
+      ASSERT_EQ(a_h(i, j), c(i, j));
+      ASSERT_GE(a_h(i, j), -1.);
+      ASSERT_LT(a_h(i, j), 1.);
+    }
+  }
+  ASSERT_LT(equal, 10);
+
+  // Skipping ahead must be equivalent to drawing
+  auto gen_seq  = pool.get_state(7);
+  auto gen_skip = pool.get_state(7, 5);
+  for (int k = 0; k < 10; ++k) gen_seq.urand64();
+  ASSERT_EQ(gen_seq.offset(), gen_skip.offset());
+  for (int k = 0; k < 10; ++k) ASSERT_EQ(gen_seq.urand64(), gen_skip.urand64());
+
+  // A different seed yields a different stream
+  Pool other(27182);
+  auto gen_other = other.get_state(7);
+  auto gen_ref   = pool.get_state(7);
+  ASSERT_NE(gen_other.urand64(), gen_ref.urand64());
+}
+
+template <class ExecutionSpace, class Pool>
+void test_counter_based_simd() {
+  using namespace Kokkos::Experimental;
+  using abi_type  = simd_abi::ForSpace<ExecutionSpace>;
+  using simd_type = simd<double, abi_type>;
+
+  const int n = 1003;  // not a multiple of the simd width
+  Pool pool(2718);
+  Pool same(2718);
+
+  // The generator of element e of the k-th fill from a pool, filling
+  // num_elements with values_per_block values per block
+  auto fill_state = [&](uint64_t k, int e, int num_elements,
+                        int values_per_block) {
+    const int num_streams =
+        (num_elements + values_per_block - 1) / values_per_block;
+    auto gen = pool.get_state(e % num_streams, k * Pool::blocks_per_fill);
+    for (int w = 0; w < e / num_streams; ++w) gen.urand64();
+    return gen;
+  };
+
+  // The SIMD (LayoutRight) and scalar (LayoutLeft) fill paths must agree with
+  // the generators handed out by the pool
+  Kokkos::View<double**, Kokkos::LayoutRight, ExecutionSpace> a("A", n, 3);
+  Kokkos::View<double**, Kokkos::LayoutLeft, ExecutionSpace> b("B", n, 3);
+  Kokkos::View<double*, ExecutionSpace> c("C", 3 * n);
+  Kokkos::View<double*, ExecutionSpace> d("D", 3 * n);
+  ExecutionSpace exec;
+  Kokkos::fill_random(exec, a, pool, -2., 3.);
+  Kokkos::fill_random(exec, b, same, -2., 3.);
+  fill_random_normal(exec, c, pool, 1., 2.);
+  fill_random_exponential(exec, d, pool, 4.);
+
+  auto a_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, a);
+  auto b_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, b);
+  auto c_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, c);
+  auto d_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, d);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      auto gen = fill_state(1, 3 * i + j, 3 * n, 2);
+      ASSERT_DOUBLE_EQ(a_h(i, j), gen.drand(-2., 3.));
+      ASSERT_EQ(a_h(i, j), b_h(i, j));
+    }
+  }
+  for (int i = 0; i < 3 * n; ++i) {
+    auto gen_c = fill_state(2, i, 3 * n, 1);
+    ASSERT_NEAR(c_h(i), gen_c.normal(1., 2.), 1e-12 * (1. + std::abs(c_h(i))));
+    auto gen_d = fill_state(3, i, 3 * n, 2);
+    ASSERT_NEAR(d_h(i), gen_d.exponential(4.), 1e-12 * (1. + d_h(i)));
+    ASSERT_GE(d_h(i), 0.);
+  }
+
+  // Packs are the lane-wise equivalent of the scalar generators
+  simd_type u = simd_drand<abi_type>(pool, 40);
+  simd_type z = simd_normal<abi_type>(pool, 40);
+  simd_type e = simd_exponential<abi_type>(pool, 40);
+  for (std::size_t l = 0; l < simd_type::size(); ++l) {
+    ASSERT_EQ(u[l], pool.get_state(40 + l).drand());
+    ASSERT_NEAR(z[l], pool.get_state(40 + l).normal(), 1e-12);
+    ASSERT_NEAR(e[l], pool.get_state(40 + l).exponential(), 1e-12);
+  }
+
+  // Moments of the bulk distributions
+  const int m = 1 << 20;
+  Kokkos::View<double*, ExecutionSpace> x("X", m);
+  double sum = 0, sum_sq = 0;
+  fill_random_normal(exec, x, pool, 1., 2.);
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecutionSpace>(exec, 0, m),
+      KOKKOS_LAMBDA(int i, double& s1, double& s2) {
+        s1 += x(i);
+        s2 += x(i) * x(i);
+      },
+      sum, sum_sq);
+  double mean = sum / m;
+  ASSERT_NEAR(mean, 1., 0.01);
+  ASSERT_NEAR(sum_sq / m - mean * mean, 4., 0.04);
+
+  fill_random_exponential(exec, x, pool, 4.);
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecutionSpace>(exec, 0, m),
+      KOKKOS_LAMBDA(int i, double& s1, double& s2) {
+        s1 += x(i);
+        s2 += x(i) * x(i);
+      },
+      sum, sum_sq);
+  mean = sum / m;
+  ASSERT_NEAR(mean, 0.25, 0.0025);
+  ASSERT_NEAR(sum_sq / m - mean * mean, 0.0625, 0.002);
+}
+
 }  // namespace AlgoRandomImpl
 
+// Known answer tests from the Random123 distribution
+TEST(TEST_CATEGORY, Random_Philox4x32_KnownAnswers) {
+  using Kokkos::Impl::Random_Philox4x32_10;
+  {
+    uint32_t ctr[4]       = {0, 0, 0, 0};
+    const uint32_t key[2] = {0, 0};
+    Random_Philox4x32_10::apply(ctr, key);
+    ASSERT_EQ(ctr[0], 0x6627e8d5U);
+    ASSERT_EQ(ctr[1], 0xe169c58dU);
+    ASSERT_EQ(ctr[2], 0xbc57ac4cU);
+    ASSERT_EQ(ctr[3], 0x9b00dbd8U);
+  }
+  {
+    uint32_t ctr[4] = {0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU};
+    const uint32_t key[2] = {0xffffffffU, 0xffffffffU};
+    Random_Philox4x32_10::apply(ctr, key);
+    ASSERT_EQ(ctr[0], 0x408f276dU);
+    ASSERT_EQ(ctr[1], 0x41c83b0eU);
+    ASSERT_EQ(ctr[2], 0xa20bc7c6U);
+    ASSERT_EQ(ctr[3], 0x6d5451fdU);
+  }
+  {
+    uint32_t ctr[4] = {0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U};
+    const uint32_t key[2] = {0xa4093822U, 0x299f31d0U};
+    Random_Philox4x32_10::apply(ctr, key);
+    ASSERT_EQ(ctr[0], 0xd16cfe09U);
+    ASSERT_EQ(ctr[1], 0x94fdccebU);
+    ASSERT_EQ(ctr[2], 0x5001e420U);
+    ASSERT_EQ(ctr[3], 0x24126ea1U);
+  }
+}
+
+TEST(TEST_CATEGORY, Random_Threefry2x64_KnownAnswers) {
+  using Kokkos::Impl::Random_Threefry2x64_20;
+  {
+    uint64_t ctr[2]       = {0, 0};
+    const uint64_t key[2] = {0, 0};
+    Random_Threefry2x64_20::apply(ctr, key);
+    ASSERT_EQ(ctr[0], 0xc2b6e3a8c2c69865ULL);
+    ASSERT_EQ(ctr[1], 0x6f81ed42f350084dULL);
+  }
+  {
+    uint64_t ctr[2]       = {~0ULL, ~0ULL};
+    const uint64_t key[2] = {~0ULL, ~0ULL};
+    Random_Threefry2x64_20::apply(ctr, key);
+    ASSERT_EQ(ctr[0], 0xe02cb7c4d95d277aULL);
+    ASSERT_EQ(ctr[1], 0xd06633d0893b8b68ULL);
+  }
+  {
+    uint64_t ctr[2]       = {0x243f6a8885a308d3ULL, 0x13198a2e03707344ULL};
+    const uint64_t key[2] = {0xa4093822299f31d0ULL, 0x082efa98ec4e6c89ULL};
+    Random_Threefry2x64_20::apply(ctr, key);
+    ASSERT_EQ(ctr[0], 0x263c7d30bb0f0af1ULL);
+    ASSERT_EQ(ctr[1], 0x56be8361d3311526ULL);
+  }
+}
+
 TEST(TEST_CATEGORY, Random_XorShift64) {
   // FIXME_OPENMPTARGET - causes runtime failure with CrayClang compiler
 #if defined(KOKKOS_COMPILER_CRAY_LLVM) && defined(KOKKOS_ENABLE_OPENMPTARGET)
@@ -610,5 +807,41 @@ TEST(TEST_CATEGORY, Multi_streams) {
   AlgoRandomImpl::test_duplicate_stream<ExecutionSpace, Pool1024>();
 }
 
+TEST(TEST_CATEGORY, Random_CounterBased) {
+  using ExecutionSpace = TEST_EXECSPACE;
+
+#if defined(KOKKOS_ENABLE_SYCL) || defined(KOKKOS_ENABLE_CUDA) || \
+    defined(KOKKOS_ENABLE_HIP)
+  const int num_draws = 52428813;
+#else  // SERIAL, HPX, OPENMP
+  const int num_draws = 10130144;
+#endif
+  using PoolPhilox =
+      Kokkos::Experimental::Random_Philox4x32_Pool<ExecutionSpace>;
+  using PoolThreefry =
+      Kokkos::Experimental::Random_Threefry2x64_Pool<ExecutionSpace>;
+
+  AlgoRandomImpl::test_random<PoolPhilox>(num_draws);
+  AlgoRandomImpl::test_random<PoolThreefry>(num_draws);
+  AlgoRandomImpl::TestDynRankView<ExecutionSpace, PoolPhilox>(10000).run();
+  AlgoRandomImpl::test_duplicate_stream<ExecutionSpace, PoolPhilox>();
+  AlgoRandomImpl::test_duplicate_stream<ExecutionSpace, PoolThreefry>();
+  AlgoRandomImpl::test_counter_based_reproducible<ExecutionSpace,
+                                                  PoolPhilox>();
+  AlgoRandomImpl::test_counter_based_reproducible<ExecutionSpace,
+                                                  PoolThreefry>();
+}
+
+TEST(TEST_CATEGORY, Random_CounterBased_SIMD) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  using PoolPhilox =
+      Kokkos::Experimental::Random_Philox4x32_Pool<ExecutionSpace>;
+  using PoolThreefry =
+      Kokkos::Experimental::Random_Threefry2x64_Pool<ExecutionSpace>;
+
+  AlgoRandomImpl::test_counter_based_simd<ExecutionSpace, PoolPhilox>();
+  AlgoRandomImpl::test_counter_based_simd<ExecutionSpace, PoolThreefry>();
+}
+
 }  // namespace Test
 #endif
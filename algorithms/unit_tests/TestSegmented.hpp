@@ -0,0 +1,162 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_ALGORITHMS_UNITTESTS_TEST_SEGMENTED_HPP
+#define KOKKOS_ALGORITHMS_UNITTESTS_TEST_SEGMENTED_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Segmented.hpp>
+#include <vector>
+
+namespace Test {
+namespace Segmented {
+
+struct MaxOp {
+  KOKKOS_FUNCTION int operator()(int a, int b) const { return a < b ? b : a; }
+};
+
+// lengths of the segments: one long segment, runs of empty and short ones
+inline std::vector<std::size_t> skewed_row_map() {
+  std::vector<std::size_t> row_map{0};
+  auto add = [&](std::size_t length) {
+    row_map.push_back(row_map.back() + length);
+  };
+  add(0);
+  add(3);
+  add(5000);
+  for (int i = 0; i < 200; ++i) add(i % 3 == 0 ? 0 : i % 7);
+  add(1);
+  add(777);
+  for (int i = 0; i < 50; ++i) add(0);
+  return row_map;
+}
+
+template <class ExecutionSpace>
+void test_segmented(const std::vector<std::size_t>& row_map_in,
+                    std::size_t num_chunks) {
+  using row_map_type = Kokkos::View<std::size_t*, ExecutionSpace>;
+  using values_type  = Kokkos::View<int*, ExecutionSpace>;
+
+  const std::size_t num_rows    = row_map_in.size() - 1;
+  const std::size_t num_entries = row_map_in.back();
+  auto row_map_h = Kokkos::create_mirror_view(row_map_type(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "row_map"),
+      row_map_in.size()));
+  for (std::size_t i = 0; i < row_map_in.size(); ++i) {
+    row_map_h(i) = row_map_in[i];
+  }
+  auto values_h = Kokkos::create_mirror_view(values_type(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "values"),
+      num_entries));
+  for (std::size_t j = 0; j < num_entries; ++j) {
+    values_h(j) = int((j * 7919) % 1001) - 500;
+  }
+  auto row_map = Kokkos::create_mirror_view_and_copy(ExecutionSpace(),
+                                                     row_map_h);
+  auto values =
+      Kokkos::create_mirror_view_and_copy(ExecutionSpace(), values_h);
+
+  values_type sums("sums", num_rows);
+  values_type maxima("maxima", num_rows);
+  values_type scan("scan", num_entries);
+  values_type max_scan("max_scan", num_entries);
+  ExecutionSpace exec;
+  Kokkos::Impl::merge_path_segmented<false>(
+      exec, row_map, values, sums, Kokkos::Impl::SegmentedSumOp<int>(),
+      num_chunks);
+  Kokkos::Impl::merge_path_segmented<false>(exec, row_map, values, maxima,
+                                            MaxOp(), num_chunks);
+  Kokkos::Impl::merge_path_segmented<true>(
+      exec, row_map, values, scan, Kokkos::Impl::SegmentedSumOp<int>(),
+      num_chunks);
+  Kokkos::Impl::merge_path_segmented<true>(exec, row_map, values, max_scan,
+                                           MaxOp(), num_chunks);
+
+  auto sums_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), sums);
+  auto maxima_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), maxima);
+  auto scan_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), scan);
+  auto max_scan_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), max_scan);
+  for (std::size_t row = 0; row < num_rows; ++row) {
+    int sum     = 0;
+    int maximum = 0;
+    for (std::size_t j = row_map_in[row]; j < row_map_in[row + 1]; ++j) {
+      sum += values_h(j);
+      maximum = j == row_map_in[row] ? values_h(j)
+                                     : MaxOp()(maximum, values_h(j));
+      ASSERT_EQ(scan_h(j), sum) << "entry " << j << ", chunks " << num_chunks;
+      ASSERT_EQ(max_scan_h(j), maximum)
+          << "entry " << j << ", chunks " << num_chunks;
+    }
+    ASSERT_EQ(sums_h(row), sum) << "row " << row << ", chunks " << num_chunks;
+    ASSERT_EQ(maxima_h(row), maximum)
+        << "row " << row << ", chunks " << num_chunks;
+  }
+}
+
+}  // namespace Segmented
+
+TEST(TEST_CATEGORY, segmented_merge_path_chunks) {
+  const auto row_map = Segmented::skewed_row_map();
+  for (std::size_t num_chunks : {1, 2, 3, 7, 64, 1000, 20000}) {
+    Segmented::test_segmented<TEST_EXECSPACE>(row_map, num_chunks);
+  }
+  Segmented::test_segmented<TEST_EXECSPACE>({0}, 4);
+  Segmented::test_segmented<TEST_EXECSPACE>({0, 0, 0}, 4);
+  Segmented::test_segmented<TEST_EXECSPACE>({0, 10}, 4);
+}
+
+TEST(TEST_CATEGORY, segmented_reduce_and_scan) {
+  using ExecutionSpace = TEST_EXECSPACE;
+  // the segments of a row map starting past the first entry
+  Kokkos::View<int*, ExecutionSpace> row_map("row_map", 5);
+  Kokkos::View<double*, ExecutionSpace> values("values", 12);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecutionSpace>(0, 12), KOKKOS_LAMBDA(int j) {
+        values(j) = j;
+        if (j < 5) row_map(j) = j == 0 ? 2 : j == 1 ? 2 : j == 2 ? 9 : 11;
+      });
+  Kokkos::View<const int*, ExecutionSpace> const_row_map = row_map;
+
+  Kokkos::View<double*, ExecutionSpace> sums("sums", 4);
+  Kokkos::View<double*, ExecutionSpace> scan("scan", 12);
+  ExecutionSpace exec;
+  Kokkos::Experimental::segmented_reduce(exec, const_row_map, values, sums);
+  Kokkos::Experimental::segmented_inclusive_scan(exec, const_row_map, values,
+                                                 scan);
+
+  auto sums_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), sums);
+  auto scan_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), scan);
+  // segments [2, 2), [2, 9), [9, 11), [11, 11)
+  ASSERT_EQ(sums_h(0), 0.);
+  ASSERT_EQ(sums_h(1), 2. + 3. + 4. + 5. + 6. + 7. + 8.);
+  ASSERT_EQ(sums_h(2), 9. + 10.);
+  ASSERT_EQ(sums_h(3), 0.);
+  ASSERT_EQ(scan_h(0), 0.);
+  ASSERT_EQ(scan_h(1), 0.);
+  ASSERT_EQ(scan_h(2), 2.);
+  ASSERT_EQ(scan_h(8), 35.);
+  ASSERT_EQ(scan_h(9), 9.);
+  ASSERT_EQ(scan_h(10), 19.);
+  ASSERT_EQ(scan_h(11), 0.);
+}
+
+}  // namespace Test
+#endif
@@ -0,0 +1,107 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <TestStdAlgorithmsCommon.hpp>
+#include <algorithm>
+#include <numeric>
+
+// The algorithms with simd fast paths on host, checked against std:: on
+// contiguous Views with partial last packs and chunks, and with the first
+// match at the start, in the middle, at the end, or missing.
+
+namespace Test {
+namespace stdalgos {
+namespace SimdFastPaths {
+
+namespace KE = Kokkos::Experimental;
+
+template <class ValueType>
+void test_simd_fast_paths(std::size_t ext) {
+  using view_t = Kokkos::View<ValueType*, exespace>;
+  view_t view("view", ext);
+  view_t other("other", ext);
+  auto h_view  = Kokkos::create_mirror_view(view);
+  auto h_other = Kokkos::create_mirror_view(other);
+  for (std::size_t i = 0; i < ext; ++i) {
+    // every value occurs more than once, so that the first and the last
+    // extrema differ
+    h_view(i) = ValueType((i * 37) % 101);
+  }
+
+  const std::size_t positions[] = {0, ext / 2, ext - 1, ext};
+  for (std::size_t pos : positions) {
+    // a value found first at pos, or not at all
+    const ValueType value =
+        pos < ext ? ValueType(h_view(pos)) : ValueType(1000);
+    for (std::size_t i = 0; i < ext; ++i) {
+      h_other(i) = i < pos ? h_view(i) : ValueType(h_view(i) + 1);
+    }
+    Kokkos::deep_copy(view, h_view);
+    Kokkos::deep_copy(other, h_other);
+
+    const auto h_begin = KE::cbegin(h_view);
+    const auto h_end   = KE::cend(h_view);
+    const auto begin   = KE::begin(view);
+
+    EXPECT_EQ(KE::find(exespace(), view, value) - begin,
+              std::find(h_begin, h_end, value) - h_begin);
+    EXPECT_EQ(KE::count(exespace(), view, value),
+              std::count(h_begin, h_end, value));
+    const auto mismatch = KE::mismatch(exespace(), view, other);
+    EXPECT_EQ(mismatch.first - begin,
+              std::mismatch(h_begin, h_end, KE::cbegin(h_other)).first -
+                  h_begin);
+    EXPECT_EQ(KE::equal(exespace(), view, other), pos == ext);
+  }
+
+  // adjacent_find with a single pair of equal neighbours
+  for (std::size_t pos : positions) {
+    for (std::size_t i = 0; i < ext; ++i) {
+      h_other(i) = ValueType(i);
+    }
+    if (pos + 1 < ext) h_other(pos + 1) = h_other(pos);
+    Kokkos::deep_copy(other, h_other);
+    EXPECT_EQ(KE::adjacent_find(exespace(), other) - KE::begin(other),
+              std::adjacent_find(KE::cbegin(h_other), KE::cend(h_other)) -
+                  KE::cbegin(h_other));
+  }
+
+  const auto h_begin = KE::cbegin(h_view);
+  const auto h_end   = KE::cend(h_view);
+  const auto begin   = KE::begin(view);
+  Kokkos::deep_copy(view, h_view);
+  EXPECT_EQ(KE::reduce(exespace(), view, ValueType(3)),
+            std::accumulate(h_begin, h_end, ValueType(3)));
+  EXPECT_EQ(KE::min_element(exespace(), view) - begin,
+            std::min_element(h_begin, h_end) - h_begin);
+  EXPECT_EQ(KE::max_element(exespace(), view) - begin,
+            std::max_element(h_begin, h_end) - h_begin);
+  const auto minmax    = KE::minmax_element(exespace(), view);
+  const auto std_minmax = std::minmax_element(h_begin, h_end);
+  EXPECT_EQ(minmax.first - begin, std_minmax.first - h_begin);
+  EXPECT_EQ(minmax.second - begin, std_minmax.second - h_begin);
+}
+
+TEST(std_algorithms_simd_fast_paths_test, test) {
+  for (std::size_t ext : {1, 7, 8, 9, 255, 256, 257, 1001, 100003}) {
+    test_simd_fast_paths<double>(ext);
+    test_simd_fast_paths<int>(ext);
+  }
+}
+
+}  // namespace SimdFastPaths
+}  // namespace stdalgos
+}  // namespace Test
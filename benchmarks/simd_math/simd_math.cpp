@@ -0,0 +1,112 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/*! \file simd_math.cpp
+
+    Throughput of the <cmath> functions on the native simd<double> type,
+    compared with applying the scalar function to each lane, which is what
+    the generic fallback in Kokkos_SIMD_Common_Math.hpp does.
+
+    N controls the number of values per function
+    R controls how often the sweep over the values is repeated
+*/
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using simd_type = Kokkos::Experimental::native_simd<double>;
+
+template <class SimdOp, class ScalarOp>
+void run(char const* name, std::vector<double> const& x, int R,
+         SimdOp simd_op, ScalarOp scalar_op) {
+  constexpr std::size_t width = simd_type::size();
+  std::size_t const N         = x.size();
+  std::vector<double> y(N);
+
+  Kokkos::Timer timer;
+  for (int r = 0; r < R; ++r) {
+    for (std::size_t i = 0; i < N; i += width) {
+      simd_type v;
+      v.copy_from(x.data() + i, Kokkos::Experimental::simd_flag_default);
+      simd_op(v).copy_to(y.data() + i, Kokkos::Experimental::simd_flag_default);
+    }
+  }
+  double const time_simd = timer.seconds();
+  double const check     = y[N / 2];
+
+  timer.reset();
+  for (int r = 0; r < R; ++r) {
+    for (std::size_t i = 0; i < N; i += width) {
+      simd_type v;
+      v.copy_from(x.data() + i, Kokkos::Experimental::simd_flag_default);
+      simd_type result;
+      for (std::size_t lane = 0; lane < width; ++lane) {
+        result[lane] = scalar_op(v[lane]);
+      }
+      result.copy_to(y.data() + i, Kokkos::Experimental::simd_flag_default);
+    }
+  }
+  double const time_scalar = timer.seconds();
+
+  double const count = double(N) * R;
+  printf("%-6s %10.3f %10.3f %8.2fx   (%g, %g)\n", name,
+         1e9 * time_simd / count, 1e9 * time_scalar / count,
+         time_scalar / time_simd, check, y[N / 2]);
+}
+
+int main(int argc, char* argv[]) {
+  Kokkos::initialize(argc, argv);
+  {
+    int N = argc > 1 ? atoi(argv[1]) : 4096;
+    int R = argc > 2 ? atoi(argv[2]) : 2000;
+    N -= N % simd_type::size();
+
+    std::vector<double> x(N);
+    std::vector<double> positive(N);
+    for (int i = 0; i < N; ++i) {
+      x[i]        = -8.0 + 16.0 * (i + 0.5) / N;
+      positive[i] = 1e-3 + 1e3 * (i + 0.5) / N;
+    }
+
+    printf("simd width %d, N %d, R %d\n", int(simd_type::size()), N, R);
+    printf("%-6s %10s %10s %9s\n", "func", "simd ns", "scalar ns", "speedup");
+
+#define KOKKOS_BENCHMARK_SIMD_MATH(FUNC, ARGS)                        \
+  run(#FUNC, ARGS, R, [](simd_type const& v) { return Kokkos::FUNC(v); }, \
+      [](double v) { return Kokkos::FUNC(v); })
+
+    KOKKOS_BENCHMARK_SIMD_MATH(exp, x);
+    KOKKOS_BENCHMARK_SIMD_MATH(exp2, x);
+    KOKKOS_BENCHMARK_SIMD_MATH(log, positive);
+    KOKKOS_BENCHMARK_SIMD_MATH(log2, positive);
+    KOKKOS_BENCHMARK_SIMD_MATH(log10, positive);
+    KOKKOS_BENCHMARK_SIMD_MATH(sin, x);
+    KOKKOS_BENCHMARK_SIMD_MATH(cos, x);
+    KOKKOS_BENCHMARK_SIMD_MATH(tanh, x);
+    KOKKOS_BENCHMARK_SIMD_MATH(erf, x);
+#undef KOKKOS_BENCHMARK_SIMD_MATH
+
+    run(
+        "pow", positive, R,
+        [](simd_type const& v) { return Kokkos::pow(v, simd_type(1.7)); },
+        [](double v) { return Kokkos::pow(v, 1.7); });
+  }
+  Kokkos::finalize();
+}
@@ -0,0 +1,286 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_CombiningAtomic.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::CombiningAtomic.
+
+#ifndef KOKKOS_COMBINING_ATOMIC_HPP
+#define KOKKOS_COMBINING_ATOMIC_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_COMBININGATOMIC
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ScatterView.hpp>
+
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+
+template <typename ViewType, typename Op>
+class CombiningAtomicAccess;
+
+/// \class CombiningAtomic
+/// \brief Combines atomic updates to hot elements of a rank-1 View.
+///
+/// Kernels that update a handful of elements from every thread
+/// (histogram bins, global counters) pay for each atomic with the cache
+/// line moving between cores.  CombiningAtomic gives every thread a
+/// small direct-mapped cache of (index, value) pairs: an update to an
+/// index that is already cached is combined into the cached value
+/// without any atomic, and an update that maps to a slot holding
+/// another index first applies the evicted value to the View
+/// atomically.  flush() applies whatever is still cached once the
+/// kernels are done; the View holds the full result only after that.
+///
+/// As with ScatterView, updates are made through an object returned by
+/// access(), which looks up the calling thread once:
+/// \code
+/// Kokkos::Experimental::CombiningAtomic<Kokkos::View<int*>> bins(counts);
+/// Kokkos::parallel_for(n, KOKKOS_LAMBDA(int i) {
+///   auto access = bins.access();
+///   access(bin_of(data(i))) += 1;
+/// });
+/// bins.flush();
+/// \endcode
+///
+/// Sum, product, min and max are commutative, so the order in which
+/// cached values reach the View does not change the result (up to
+/// floating point rounding for sums and products).  On execution spaces
+/// whose memory is not host accessible the caches are not used and
+/// updates go straight to the View as atomics.
+///
+/// \tparam ViewType Rank-1 View receiving the updates.
+///
+/// \tparam Op One of ScatterSum, ScatterProd, ScatterMin or ScatterMax.
+template <typename ViewType, typename Op = Kokkos::Experimental::ScatterSum>
+class CombiningAtomic {
+  static_assert(Kokkos::is_view_v<ViewType> && ViewType::rank == 1,
+                "Kokkos::Experimental::CombiningAtomic: ViewType must be a "
+                "rank-1 View");
+
+ public:
+  using view_type       = ViewType;
+  using value_type      = typename view_type::non_const_value_type;
+  using size_type       = typename view_type::size_type;
+  using execution_space = typename view_type::execution_space;
+  using memory_space    = typename view_type::memory_space;
+  using device_type     = typename view_type::device_type;
+  using access_type     = CombiningAtomicAccess<ViewType, Op>;
+
+  /// Whether updates are combined in per-thread caches on this space.
+  static constexpr bool combines =
+      Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                 memory_space>::accessible &&
+      Kokkos::SpaceAccessibility<execution_space,
+                                 Kokkos::HostSpace>::accessible;
+
+  static constexpr size_type default_cache_size = 64;
+
+  CombiningAtomic() = default;
+
+  explicit CombiningAtomic(view_type const& view,
+                           size_type cache_size = default_cache_size)
+      : CombiningAtomic(execution_space(), view, cache_size) {}
+
+  /// \param cache_size Entries in each thread's cache, rounded up to a
+  ///   power of two.
+  CombiningAtomic(execution_space const& exec, view_type const& view,
+                  size_type cache_size = default_cache_size)
+      : m_view(view) {
+    if constexpr (combines) {
+      size_type slots = 1;
+      while (slots < cache_size) slots *= 2;
+      m_slot_mask = slots - 1;
+      m_indices   = index_view_type(
+          Kokkos::view_alloc(
+              exec, Kokkos::WithoutInitializing,
+              std::string("combining_indices_") + view.label()),
+          m_unique_token.size(), slots);
+      m_values = value_view_type(
+          Kokkos::view_alloc(exec, Kokkos::WithoutInitializing,
+                             std::string("combining_values_") + view.label()),
+          m_unique_token.size(), slots);
+      Kokkos::deep_copy(exec, m_indices, empty_index);
+    }
+  }
+
+  KOKKOS_FUNCTION view_type const& view() const { return m_view; }
+
+  KOKKOS_FUNCTION access_type access() const { return access_type(*this); }
+
+  /// Applies the cached updates to the View and empties the caches.
+  void flush(execution_space const& exec) const {
+    if constexpr (combines) {
+      auto indices = m_indices;
+      auto values  = m_values;
+      auto view    = m_view;
+      Kokkos::parallel_for(
+          "Kokkos::CombiningAtomic::flush",
+          Kokkos::MDRangePolicy<execution_space, Kokkos::Rank<2>>(
+              exec, {0, 0}, {indices.extent(0), indices.extent(1)}),
+          KOKKOS_LAMBDA(size_type thread, size_type slot) {
+            size_type const index = indices(thread, slot);
+            if (index != empty_index) {
+              atomic_value_type(view(index)).update(values(thread, slot));
+              indices(thread, slot) = empty_index;
+            }
+          });
+    }
+  }
+
+  void flush() const {
+    execution_space exec;
+    flush(exec);
+    exec.fence("Kokkos::CombiningAtomic::flush: fence after flush");
+  }
+
+ private:
+  friend class CombiningAtomicAccess<ViewType, Op>;
+
+  using unique_token_type = Kokkos::Experimental::UniqueToken<
+      execution_space, Kokkos::Experimental::UniqueTokenScope::Global>;
+  using index_view_type =
+      Kokkos::View<size_type**, Kokkos::LayoutRight, device_type>;
+  using value_view_type =
+      Kokkos::View<value_type**, Kokkos::LayoutRight, device_type>;
+  using atomic_value_type = Kokkos::Impl::Experimental::ScatterValue<
+      value_type, Op, device_type, Kokkos::Experimental::ScatterAtomic>;
+  using combine_value_type = Kokkos::Impl::Experimental::ScatterValue<
+      value_type, Op, device_type, Kokkos::Experimental::ScatterNonAtomic>;
+
+  static constexpr size_type empty_index = ~size_type(0);
+
+  KOKKOS_FORCEINLINE_FUNCTION void update(int thread, size_type index,
+                                          value_type const& value) const {
+    if constexpr (combines) {
+      size_type const slot   = index & m_slot_mask;
+      size_type& cached      = m_indices(thread, slot);
+      value_type& cached_val = m_values(thread, slot);
+      if (cached == index) {
+        combine_value_type(cached_val).update(value);
+        return;
+      }
+      if (cached != empty_index) {
+        atomic_value_type(m_view(cached)).update(cached_val);
+      }
+      cached     = index;
+      cached_val = value;
+    } else {
+      (void)thread;
+      atomic_value_type(m_view(index)).update(value);
+    }
+  }
+
+  view_type m_view;
+  unique_token_type m_unique_token;
+  index_view_type m_indices;
+  value_view_type m_values;
+  size_type m_slot_mask = 0;
+};
+
+/// \class CombiningAtomicAccess
+/// \brief Per-iterate handle to a CombiningAtomic, returned by access().
+///
+/// Holds the calling thread's unique token for as long as it lives, so
+/// it should be a local variable of the kernel body.
+template <typename ViewType, typename Op>
+class CombiningAtomicAccess {
+ public:
+  using combining_type = CombiningAtomic<ViewType, Op>;
+  using value_type     = typename combining_type::value_type;
+  using size_type      = typename combining_type::size_type;
+
+  class reference {
+   public:
+    KOKKOS_FORCEINLINE_FUNCTION void update(value_type const& value) const {
+      m_access.m_combining.update(m_access.m_thread, m_index, value);
+    }
+    KOKKOS_FORCEINLINE_FUNCTION void operator+=(value_type const& value) const {
+      static_assert(std::is_same_v<Op, Kokkos::Experimental::ScatterSum>);
+      update(value);
+    }
+    KOKKOS_FORCEINLINE_FUNCTION void operator-=(value_type const& value) const {
+      static_assert(std::is_same_v<Op, Kokkos::Experimental::ScatterSum>);
+      update(value_type(-value));
+    }
+    KOKKOS_FORCEINLINE_FUNCTION void operator++() const { *this += 1; }
+    KOKKOS_FORCEINLINE_FUNCTION void operator++(int) const { *this += 1; }
+    KOKKOS_FORCEINLINE_FUNCTION void operator--() const { *this -= 1; }
+    KOKKOS_FORCEINLINE_FUNCTION void operator--(int) const { *this -= 1; }
+    KOKKOS_FORCEINLINE_FUNCTION void operator*=(value_type const& value) const {
+      static_assert(std::is_same_v<Op, Kokkos::Experimental::ScatterProd>);
+      update(value);
+    }
+
+   private:
+    friend class CombiningAtomicAccess;
+    KOKKOS_FORCEINLINE_FUNCTION reference(CombiningAtomicAccess const& access,
+                                          size_type index)
+        : m_access(access), m_index(index) {}
+
+    CombiningAtomicAccess const& m_access;
+    size_type m_index;
+  };
+
+  KOKKOS_FORCEINLINE_FUNCTION explicit CombiningAtomicAccess(
+      combining_type const& combining)
+      : m_combining(combining),
+        m_thread(combining_type::combines
+                     ? combining.m_unique_token.acquire()
+                     : invalid_thread) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION ~CombiningAtomicAccess() {
+    if (m_thread != invalid_thread) {
+      m_combining.m_unique_token.release(m_thread);
+    }
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION CombiningAtomicAccess(
+      CombiningAtomicAccess&& other)
+      : m_combining(other.m_combining), m_thread(other.m_thread) {
+    other.m_thread = invalid_thread;
+  }
+
+  CombiningAtomicAccess(CombiningAtomicAccess const&)            = delete;
+  CombiningAtomicAccess& operator=(CombiningAtomicAccess const&) = delete;
+  CombiningAtomicAccess& operator=(CombiningAtomicAccess&&)      = delete;
+
+  KOKKOS_FORCEINLINE_FUNCTION reference operator()(size_type index) const {
+    return reference(*this, index);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION reference operator[](size_type index) const {
+    return reference(*this, index);
+  }
+
+ private:
+  static constexpr int invalid_thread = -1;
+
+  combining_type const& m_combining;
+  int m_thread;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_COMBININGATOMIC
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_COMBININGATOMIC
+#endif
+#endif
@@ -0,0 +1,277 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_ConcurrentQueue.hpp
+/// \brief Declaration and definition of
+///   Kokkos::Experimental::ConcurrentQueue.
+
+#ifndef KOKKOS_CONCURRENT_QUEUE_HPP
+#define KOKKOS_CONCURRENT_QUEUE_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_CONCURRENTQUEUE
+#endif
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class ConcurrentQueue
+/// \brief Fixed capacity first-in first-out work list for device code.
+///
+/// Items are appended at the tail and taken from the head by any number
+/// of threads of a kernel, concurrently.  The slots are not reused: the
+/// capacity bounds the number of items pushed between two calls to
+/// reset(), which is meant to be called between the phases of an
+/// algorithm, for instance the levels of a breadth-first search.  After a
+/// kernel, view() holds the items pushed and not yet popped, in order.
+///
+/// push_n() and pop_n() reserve all their slots with a single atomic
+/// operation.  The team versions reserve the slots of all threads of a
+/// team with a single atomic operation, so that a TeamPolicy with teams
+/// of the size of a warp aggregates the reservations of a warp.  The head
+/// and the tail are on different cache lines.
+///
+/// An item may be popped while it is being pushed, in which case pop
+/// waits until it is written.  On GPUs without independent thread
+/// scheduling a thread must therefore not pop items pushed by another
+/// thread of its own warp in the same kernel.
+///
+/// \tparam T Type of the items, trivially copyable.
+///
+/// \tparam Device The Kokkos Device type.
+template <typename T, typename Device = Kokkos::DefaultExecutionSpace>
+class ConcurrentQueue {
+ public:
+  //! \name Public types and constants
+  //@{
+  using value_type      = T;
+  using device_type     = Device;
+  using execution_space = typename Device::execution_space;
+  using memory_space    = typename Device::memory_space;
+  using size_type       = uint32_t;
+
+  using view_type = View<value_type *, device_type>;
+  //@}
+
+ private:
+  // Head, tail and flags on separate cache lines
+  enum : size_type { line = 64 / sizeof(size_type) };
+  enum : size_type { head_idx = 0, tail_idx = line };
+  enum : size_type { failed_push_idx = 2 * line, num_scalars = 3 * line };
+
+  using scalars_view = View<size_type[num_scalars], LayoutLeft, device_type>;
+  using ready_view   = View<size_type *, device_type>;
+
+ public:
+  //! \name Public member functions
+  //@{
+
+  /// \brief Constructor
+  ///
+  /// \param capacity [in] Maximum number of items pushed between resets.
+  ConcurrentQueue(size_type capacity = 0,
+                  std::string const &label = "ConcurrentQueue")
+      : m_items(view_alloc(WithoutInitializing, label + " - items"),
+                capacity),
+        m_ready(label + " - ready", capacity),
+        m_scalars(label + " - scalars") {}
+
+  /// \brief The maximum number of items pushed between resets.
+  KOKKOS_FORCEINLINE_FUNCTION
+  size_type capacity() const { return m_items.extent(0); }
+
+  /// \brief The number of items pushed and not yet popped.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be called in
+  /// a parallel kernel.
+  size_type size() const {
+    const Kokkos::pair<size_type, size_type> range = get_head_tail();
+    return range.second - range.first;
+  }
+
+  /// \brief Whether a push failed since the last reset because the queue
+  ///   was full.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be called in
+  /// a parallel kernel.
+  bool failed_push() const { return get_scalar(failed_push_idx) != 0; }
+
+  /// \brief The items pushed and not yet popped, in order.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be called in
+  /// a parallel kernel.
+  view_type view() const { return Kokkos::subview(m_items, get_head_tail()); }
+
+  /// \brief Empty the queue, making all of its capacity available again.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be called in
+  /// a parallel kernel.
+  void reset() {
+    const size_type used = get_head_tail().second;
+    Kokkos::deep_copy(Kokkos::subview(m_ready, Kokkos::make_pair(0u, used)),
+                      0);
+    Kokkos::deep_copy(m_scalars, 0);
+  }
+
+  /// \brief Append \c value, return whether there was room for it.
+  KOKKOS_INLINE_FUNCTION
+  bool push(value_type const &value) const { return push_n(&value, 1) == 1; }
+
+  /// \brief Append the \c n items of \c values, return how many there was
+  ///   room for.
+  KOKKOS_INLINE_FUNCTION
+  size_type push_n(value_type const *values, size_type n) const {
+    if (n == 0) return 0;
+    return store(atomic_fetch_add(&m_scalars(tail_idx), n), values, n);
+  }
+
+  /// \brief Append the \c n items of \c values of each thread of the team,
+  ///   in order of team rank; return how many of the thread's items there
+  ///   was room for.
+  ///
+  /// Must be called by all threads of the team.
+  template <typename TeamMemberType>
+  KOKKOS_INLINE_FUNCTION size_type push_n(TeamMemberType const &team,
+                                          value_type const *values,
+                                          size_type n) const {
+    const size_type begin = team.team_scan(n, &m_scalars(tail_idx));
+    return n ? store(begin, values, n) : 0;
+  }
+
+  /// \brief Take the item at the head into \c value, return false if the
+  ///   queue is empty.
+  KOKKOS_INLINE_FUNCTION
+  bool pop(value_type &value) const { return pop_n(&value, 1) == 1; }
+
+  /// \brief Take up to \c n items from the head into \c values, return how
+  ///   many were taken.
+  KOKKOS_INLINE_FUNCTION
+  size_type pop_n(value_type *values, size_type n) const {
+    size_type count       = 0;
+    const size_type begin = reserve_pop(n, count);
+    load(begin, values, count);
+    return count;
+  }
+
+  /// \brief Take up to \c n items from the head into \c values for each
+  ///   thread of the team, the items being assigned in order of team
+  ///   rank; return how many were taken by the thread.
+  ///
+  /// Must be called by all threads of the team.
+  template <typename TeamMemberType>
+  KOKKOS_INLINE_FUNCTION size_type pop_n(TeamMemberType const &team,
+                                         value_type *values,
+                                         size_type n) const {
+    const size_type offset = team.team_scan(n);
+    size_type total        = n;
+    team.team_reduce(Kokkos::Sum<size_type>(total));
+
+    Kokkos::pair<size_type, size_type> reserved;
+    Kokkos::single(
+        Kokkos::PerTeam(team),
+        [&](Kokkos::pair<size_type, size_type> &r) {
+          r.first = reserve_pop(total, r.second);
+        },
+        reserved);
+
+    const size_type count =
+        reserved.second > offset
+            ? (reserved.second - offset < n ? reserved.second - offset : n)
+            : 0;
+    load(reserved.first + offset, values, count);
+    return count;
+  }
+  //@}
+
+ private:
+  // Write the items to the slots from begin that are within the capacity
+  KOKKOS_INLINE_FUNCTION
+  size_type store(size_type begin, value_type const *values,
+                  size_type n) const {
+    const size_type cap = capacity();
+    const size_type count =
+        begin < cap ? (cap - begin < n ? cap - begin : n) : 0;
+    if (count < n && !m_scalars(failed_push_idx)) {
+      m_scalars(failed_push_idx) = 1;
+    }
+    for (size_type i = 0; i < count; ++i) m_items(begin + i) = values[i];
+    Kokkos::memory_fence();
+    for (size_type i = 0; i < count; ++i) {
+      Kokkos::atomic_store(&m_ready(begin + i), size_type(1));
+    }
+    return count;
+  }
+
+  // Claim up to n slots at the head that have been reserved by pushes
+  KOKKOS_INLINE_FUNCTION
+  size_type reserve_pop(size_type n, size_type &count) const {
+    const size_type cap = capacity();
+    size_type head      = Kokkos::atomic_load(&m_scalars(head_idx));
+    for (;;) {
+      size_type tail = Kokkos::atomic_load(&m_scalars(tail_idx));
+      tail           = tail < cap ? tail : cap;
+      count          = tail - head < n ? tail - head : n;
+      if (count == 0) return head;
+      const size_type prev =
+          atomic_compare_exchange(&m_scalars(head_idx), head, head + count);
+      if (prev == head) return head;
+      head = prev;
+    }
+  }
+
+  // Read the items of the claimed slots, waiting for pushes in progress
+  KOKKOS_INLINE_FUNCTION
+  void load(size_type begin, value_type *values, size_type count) const {
+    for (size_type i = 0; i < count; ++i) {
+      while (!Kokkos::atomic_load(&m_ready(begin + i))) {
+      }
+    }
+    Kokkos::memory_fence();
+    for (size_type i = 0; i < count; ++i) values[i] = m_items(begin + i);
+  }
+
+  size_type get_scalar(size_type i) const {
+    size_type result = 0;
+    Kokkos::deep_copy(result, Kokkos::subview(m_scalars, i));
+    return result;
+  }
+
+  // Head and tail, the tail clamped to the capacity
+  Kokkos::pair<size_type, size_type> get_head_tail() const {
+    const size_type head = get_scalar(head_idx);
+    const size_type tail = get_scalar(tail_idx);
+    return {head, tail < capacity() ? tail : capacity()};
+  }
+
+ private:  // private members
+  view_type m_items;
+  ready_view m_ready;
+  scalars_view m_scalars;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_CONCURRENTQUEUE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_CONCURRENTQUEUE
+#endif
+#endif  // KOKKOS_CONCURRENT_QUEUE_HPP
@@ -30,6 +30,8 @@
 #include <Kokkos_Core.hpp>
 #include <impl/Kokkos_Error.hpp>
 
+#include <algorithm>
+
 namespace Kokkos {
 
 /* \class DualView
@@ -208,6 +210,17 @@ class DualView : public ViewTraits<DataType, Properties...> {
   using t_modified_flags = View<unsigned int[2], LayoutLeft, Kokkos::HostSpace>;
   t_modified_flags modified_flags;
 
+  // Bitmaps of the blocks of indices of the leading dimension marked as
+  // modified by modify(begin, end) and friends
+  // dirty_blocks(:, 0) -> host
+  // dirty_blocks(:, 1) -> device
+  using t_dirty_blocks =
+      View<unsigned int* [2], LayoutLeft, Kokkos::HostSpace>;
+  t_dirty_blocks dirty_blocks;
+  // A subview shares the bitmaps of its parent, whose blocks it cannot map
+  // to its own indices
+  bool dirty_blocks_of_parent = false;
+
  public:
   //@}
 
@@ -252,7 +265,9 @@ class DualView : public ViewTraits<DataType, Properties...> {
                                "DualView::modified_flags")),
         d_view(label, n0, n1, n2, n3, n4, n5, n6, n7),
         h_view(create_mirror_view(d_view))  // without UVM, host View mirrors
-  {}
+  {
+    impl_alloc_dirty_blocks();
+  }
 
   /// \brief Constructor that allocates View objects on both host and device.
   ///
@@ -283,12 +298,15 @@ class DualView : public ViewTraits<DataType, Properties...> {
       h_view = Kokkos::create_mirror_view(Kokkos::WithoutInitializing, d_view);
     else
       h_view = Kokkos::create_mirror_view(d_view);
+    impl_alloc_dirty_blocks();
   }
 
   //! Copy constructor (shallow copy)
   template <typename DT, typename... DP>
   DualView(const DualView<DT, DP...>& src)
       : modified_flags(src.modified_flags),
+        dirty_blocks(src.dirty_blocks),
+        dirty_blocks_of_parent(src.dirty_blocks_of_parent),
         d_view(src.d_view),
         h_view(src.h_view) {}
 
@@ -296,6 +314,8 @@ class DualView : public ViewTraits<DataType, Properties...> {
   template <class DT, class... DP, class Arg0, class... Args>
   DualView(const DualView<DT, DP...>& src, const Arg0& arg0, Args... args)
       : modified_flags(src.modified_flags),
+        dirty_blocks(src.dirty_blocks),
+        dirty_blocks_of_parent(true),
         d_view(Kokkos::subview(src.d_view, arg0, args...)),
         h_view(Kokkos::subview(src.h_view, arg0, args...)) {}
 
@@ -334,6 +354,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
       Kokkos::Impl::throw_runtime_exception(
           "DualView constructed with incompatible views");
     }
+    impl_alloc_dirty_blocks();
   }
   // does the DualView have only one device
   struct impl_dualview_is_single_device {
@@ -580,6 +601,9 @@ class DualView : public ViewTraits<DataType, Properties...> {
 
         deep_copy(args..., d_view, h_view);
         modified_flags(0) = modified_flags(1) = 0;
+        impl_clear_dirty_blocks();
+        impl_report_device_sync();
+      } else if (impl_sync_dirty_blocks(0, args...)) {
         impl_report_device_sync();
       }
     }
@@ -597,6 +621,9 @@ class DualView : public ViewTraits<DataType, Properties...> {
 
         deep_copy(args..., h_view, d_view);
         modified_flags(0) = modified_flags(1) = 0;
+        impl_clear_dirty_blocks();
+        impl_report_host_sync();
+      } else if (impl_sync_dirty_blocks(1, args...)) {
         impl_report_host_sync();
       }
     }
@@ -636,14 +663,18 @@ class DualView : public ViewTraits<DataType, Properties...> {
     int dev = get_device_side<Device>();
 
     if (dev == 1) {  // if Device is the same as DualView's device type
-      if ((modified_flags(0) > 0) && (modified_flags(0) >= modified_flags(1))) {
+      if (((modified_flags(0) > 0) &&
+           (modified_flags(0) >= modified_flags(1))) ||
+          impl_has_dirty_blocks(0)) {
         Impl::throw_runtime_exception(
             "Calling sync on a DualView with a const datatype.");
       }
       impl_report_device_sync();
     }
     if (dev == 0) {  // hopefully Device is the same as DualView's host type
-      if ((modified_flags(1) > 0) && (modified_flags(1) >= modified_flags(0))) {
+      if (((modified_flags(1) > 0) &&
+           (modified_flags(1) >= modified_flags(0))) ||
+          impl_has_dirty_blocks(1)) {
         Impl::throw_runtime_exception(
             "Calling sync on a DualView with a const datatype.");
       }
@@ -690,6 +721,9 @@ class DualView : public ViewTraits<DataType, Properties...> {
 
       deep_copy(args..., h_view, d_view);
       modified_flags(1) = modified_flags(0) = 0;
+      impl_clear_dirty_blocks();
+      impl_report_host_sync();
+    } else if (impl_sync_dirty_blocks(1, args...)) {
       impl_report_host_sync();
     }
   }
@@ -721,6 +755,9 @@ class DualView : public ViewTraits<DataType, Properties...> {
 
       deep_copy(args..., d_view, h_view);
       modified_flags(1) = modified_flags(0) = 0;
+      impl_clear_dirty_blocks();
+      impl_report_device_sync();
+    } else if (impl_sync_dirty_blocks(0, args...)) {
       impl_report_device_sync();
     }
   }
@@ -740,23 +777,25 @@ class DualView : public ViewTraits<DataType, Properties...> {
       if ((modified_flags(0) > 0) && (modified_flags(0) >= modified_flags(1))) {
         return true;
       }
+      return impl_has_dirty_blocks(0);
     }
     if (dev == 0) {  // hopefully Device is the same as DualView's host type
       if ((modified_flags(1) > 0) && (modified_flags(1) >= modified_flags(0))) {
         return true;
       }
+      return impl_has_dirty_blocks(1);
     }
     return false;
   }
 
   inline bool need_sync_host() const {
     if (modified_flags.data() == nullptr) return false;
-    return modified_flags(0) < modified_flags(1);
+    return modified_flags(0) < modified_flags(1) || impl_has_dirty_blocks(1);
   }
 
   inline bool need_sync_device() const {
     if (modified_flags.data() == nullptr) return false;
-    return modified_flags(1) < modified_flags(0);
+    return modified_flags(1) < modified_flags(0) || impl_has_dirty_blocks(0);
   }
   void impl_report_device_modification() {
     if (Kokkos::Tools::Experimental::get_callbacks().modify_dual_view !=
@@ -892,8 +931,209 @@ class DualView : public ViewTraits<DataType, Properties...> {
   inline void clear_sync_state() {
     if (modified_flags.data() != nullptr)
       modified_flags(1) = modified_flags(0) = 0;
+    if (dirty_blocks.data() != nullptr)
+      std::fill_n(dirty_blocks.data(), dirty_blocks.span(), 0u);
+  }
+
+  /// \brief Mark the indices [begin, end) of the leading dimension as
+  ///   modified on the given device \c Device.
+  ///
+  /// The next sync() to the other side only copies the blocks of indices
+  /// marked as modified since the last sync, coalescing adjacent blocks.
+  /// Copies are issued on the execution space passed to sync(), or on the
+  /// device's default execution space instance followed by a single fence.
+  /// A block covers dirty_block_bytes bytes, or a single index if the
+  /// slice of an index is larger.  Ranges are only tracked for rank-1
+  /// Views with contiguous storage and for contiguous LayoutRight Views;
+  /// for other Views, as well as when the whole View is already marked as
+  /// modified on the same side, this is equivalent to modify<Device>().
+  /// Copies of this DualView share the ranges.  A subview marks its whole
+  /// extent as modified instead, and copies its whole extent when it is
+  /// synced while ranges of its parent are marked.
+  template <class Device>
+  void modify(size_t begin, size_t end) {
+    const int dev = get_device_side<Device>();
+    if (dev >= 0) impl_modify_range(dev, begin, end);
+  }
+
+  inline void modify_host(size_t begin, size_t end) {
+    impl_modify_range(0, begin, end);
+  }
+
+  inline void modify_device(size_t begin, size_t end) {
+    impl_modify_range(1, begin, end);
+  }
+
+  //! Size in bytes of the blocks of indices tracked by modify(begin, end)
+  static constexpr size_t dirty_block_bytes = 64 * 1024;
+
+ private:
+  // Whether the indices of the leading dimension map to contiguous and
+  // disjoint ranges of the allocation
+  bool impl_can_track_ranges() const {
+    constexpr bool layout_ok =
+        (t_host::rank == 1 &&
+         std::is_same_v<typename traits::array_layout, LayoutLeft>) ||
+        std::is_same_v<typename traits::array_layout, LayoutRight>;
+    if constexpr (layout_ok) {
+      return h_view.span_is_contiguous() && d_view.span_is_contiguous() &&
+             h_view.extent(0) > 0;
+    } else {
+      return false;
+    }
+  }
+
+  // Number of elements of the slice of an index of the leading dimension
+  size_t impl_dirty_row_size() const {
+    return h_view.span() / h_view.extent(0);
+  }
+
+  // Number of indices of the leading dimension per block
+  size_t impl_dirty_block_rows() const {
+    const size_t row_bytes =
+        impl_dirty_row_size() * sizeof(typename t_host::value_type);
+    return row_bytes >= dirty_block_bytes ? 1 : dirty_block_bytes / row_bytes;
+  }
+
+  // Allocate the bitmaps for the current extents along with the Views, so
+  // that every copy of this DualView shares them.  Bitmaps of the right
+  // size are reused like the modified flags, and are filled on the host
+  // without launching a kernel.
+  void impl_alloc_dirty_blocks() {
+    if constexpr (impl_dualview_is_single_device::value) {
+      return;
+    } else {
+      if (!impl_can_track_ranges()) {
+        dirty_blocks           = t_dirty_blocks();
+        dirty_blocks_of_parent = false;
+        return;
+      }
+      const size_t rows    = impl_dirty_block_rows();
+      const size_t nblocks = (h_view.extent(0) + rows - 1) / rows;
+      const size_t nwords  = (nblocks + 31) / 32;
+      if (dirty_blocks_of_parent || dirty_blocks.extent(0) != nwords) {
+        dirty_blocks = t_dirty_blocks(
+            view_alloc(WithoutInitializing, "DualView::dirty_blocks"), nwords);
+        dirty_blocks_of_parent = false;
+      }
+      std::fill_n(dirty_blocks.data(), dirty_blocks.span(), 0u);
+    }
+  }
+
+  void impl_modify_range(int side, size_t begin, size_t end) {
+    if constexpr (impl_dualview_is_single_device::value) {
+      return;
+    } else {
+      if (end <= begin) return;
+      if (modified_flags.data() == nullptr) {
+        modified_flags = t_modified_flags("DualView::modified_flags");
+      }
+      // The whole View will be copied anyway
+      if (modified_flags(side) > 0 &&
+          modified_flags(side) >= modified_flags(1 - side))
+        return;
+      if (dirty_blocks.data() == nullptr || dirty_blocks_of_parent) {
+        side == 0 ? modify_host() : modify_device();
+        return;
+      }
+      if (end > h_view.extent(0)) {
+        Impl::throw_runtime_exception(
+            "Calling modify on a DualView with a range out of bounds.");
+      }
+
+      const size_t rows = impl_dirty_block_rows();
+      for (size_t b = begin / rows; b <= (end - 1) / rows; ++b) {
+        dirty_blocks(b / 32, side) |= 1u << (b % 32);
+      }
+      side == 0 ? impl_report_host_modification()
+                : impl_report_device_modification();
+    }
   }
 
+  bool impl_has_dirty_blocks(int side) const {
+    for (size_t w = 0; w < dirty_blocks.extent(0); ++w) {
+      if (dirty_blocks(w, side)) return true;
+    }
+    return false;
+  }
+
+  // The blocks of a parent are left to the parent, which copies them again
+  void impl_clear_dirty_blocks() {
+    if (dirty_blocks.data() != nullptr && !dirty_blocks_of_parent)
+      std::fill_n(dirty_blocks.data(), dirty_blocks.span(), 0u);
+  }
+
+  // Copy the blocks modified on side src to the other side, one copy per
+  // run of adjacent blocks, and clear them.  A subview copies its whole
+  // extent instead.  Return whether anything was copied.
+  template <class... Args>
+  bool impl_sync_dirty_blocks(int src, Args const&... args) {
+    if constexpr (std::is_const_v<typename t_host::value_type>) {
+      return false;
+    } else if (!impl_has_dirty_blocks(src)) {
+      return false;
+    } else if constexpr (sizeof...(Args) == 0) {
+      typename t_dev::execution_space exec;
+      impl_sync_dirty_blocks(src, exec);
+      exec.fence(
+          "Kokkos::DualView<>::sync: fence after copying modified blocks");
+      return true;
+    } else if (dirty_blocks_of_parent) {
+      if (src == 0) {
+        deep_copy(args..., d_view, h_view);
+      } else {
+        deep_copy(args..., h_view, d_view);
+      }
+      return true;
+    } else {
+      using scalar_type = typename t_host::value_type;
+      using host_um     = View<scalar_type*, typename t_host::device_type,
+                           MemoryUnmanaged>;
+      using dev_um =
+          View<scalar_type*, typename t_dev::device_type, MemoryUnmanaged>;
+
+      const size_t nblocks = 32 * dirty_blocks.extent(0);
+      const size_t rows    = impl_dirty_block_rows();
+      const size_t row     = impl_dirty_row_size();
+      const size_t extent  = h_view.extent(0);
+      const auto dirty     = [&](size_t b) {
+        return b < nblocks && (dirty_blocks(b / 32, src) >> (b % 32)) & 1u;
+      };
+
+      bool copied = false;
+      for (size_t b = 0; b < nblocks;) {
+        if (!dirty_blocks(b / 32, src)) {
+          b += 32;
+          continue;
+        }
+        if (!dirty(b)) {
+          ++b;
+          continue;
+        }
+        size_t e = b + 1;
+        while (dirty(e)) ++e;
+
+        const size_t first = b * rows * row;
+        const size_t last  = (e * rows < extent ? e * rows : extent) * row;
+        host_um h(h_view.data() + first, last - first);
+        dev_um d(d_view.data() + first, last - first);
+        if (src == 0) {
+          deep_copy(args..., d, h);
+        } else {
+          deep_copy(args..., h, d);
+        }
+        copied = true;
+        b      = e;
+      }
+      for (size_t w = 0; w < dirty_blocks.extent(0); ++w) {
+        dirty_blocks(w, src) = 0;
+      }
+      return copied;
+    }
+  }
+
+ public:
+
   //@}
   //! \name Methods for reallocating or resizing the View objects.
   //@{
@@ -948,6 +1188,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
       modified_flags = t_modified_flags("DualView::modified_flags");
     } else
       modified_flags(1) = modified_flags(0) = 0;
+    impl_alloc_dirty_blocks();
   }
 
   template <class... ViewCtorArgs>
@@ -1018,6 +1259,13 @@ class DualView : public ViewTraits<DataType, Properties...> {
       modified_flags = t_modified_flags("DualView::modified_flags");
     }
 
+    /* Blocks are tracked for the old extents, bring them over first */
+    if (sizeMismatch && dirty_blocks.data() != nullptr) {
+      impl_sync_dirty_blocks(0);
+      impl_sync_dirty_blocks(1);
+      impl_clear_dirty_blocks();
+    }
+
     [[maybe_unused]] auto resize_on_device = [&](const auto& properties) {
       /* Resize on Device */
       if (sizeMismatch) {
@@ -1026,6 +1274,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
         // `if constexpr`. In some cases, both branches were evaluated
         // leading to a compile error
         resync_host(properties);
+        impl_alloc_dirty_blocks();
 
         /* Mark Device copy as modified */
         ++modified_flags(1);
@@ -1040,6 +1289,7 @@ class DualView : public ViewTraits<DataType, Properties...> {
         // `if constexpr`. In some cases, both branches were evaluated
         // leading to a compile error
         resync_device(properties);
+        impl_alloc_dirty_blocks();
 
         /* Mark Host copy as modified */
         ++modified_flags(0);
@@ -443,6 +443,79 @@ class DynamicView : public Kokkos::ViewTraits<DataType, P...> {
         "DynamicView::resize_serial: Fence after copying chunks to the device");
   }
 
+  /** \brief  Grow the array by n entries from within a parallel region
+   *          on the host, return the index of the first new entry
+   *
+   *  Concurrent calls reserve disjoint ranges with an atomic on the
+   *  extent and allocate the missing chunks, each installed with a
+   *  compare-and-swap on its slot in the chunk-pointer array.  The memory
+   *  space must be accessible from the host, and the host must share the
+   *  chunk-pointer array with the device, which no copy keeps in sync here.
+   * */
+  template <typename IntType>
+  size_t grow_by(IntType const& n) const {
+    using local_value_type   = typename traits::value_type;
+    using value_pointer_type = local_value_type*;
+
+    static_assert(
+        Kokkos::SpaceAccessibility<Kokkos::HostSpace, device_space>::accessible,
+        "DynamicView::grow_by requires host accessible memory");
+    static_assert(
+        device_accessor::template IsAccessibleFrom<host_space>::value,
+        "DynamicView::grow_by requires a chunk-pointer array shared with the "
+        "host");
+
+    uintptr_t* const pc =
+        reinterpret_cast<uintptr_t*>(m_chunks_host + m_chunk_max);
+
+    // Reserve [begin, begin + n) unless that exceeds the maximum size
+    uintptr_t begin = Kokkos::atomic_load(pc + 1);
+    uintptr_t end;
+    for (;;) {
+      end = begin + n;
+      if ((uintptr_t(m_chunk_max) << m_chunk_shift) < end) {
+        Kokkos::abort("DynamicView::grow_by exceeded maximum size");
+      }
+      const uintptr_t prev =
+          Kokkos::atomic_compare_exchange(pc + 1, begin, end);
+      if (prev == begin) break;
+      begin = prev;
+    }
+
+    // Allocate the chunks of the range that no other call has installed
+    const uintptr_t NC = (end + m_chunk_mask) >> m_chunk_shift;
+    std::string _label;
+    for (uintptr_t ic = begin >> m_chunk_shift; ic < NC; ++ic) {
+      if (Kokkos::atomic_load(&m_chunks_host[ic]) != nullptr) continue;
+      if (_label.empty()) {
+        _label = m_chunks_host.track().template get_label<host_space>();
+      }
+      value_pointer_type const chunk =
+          reinterpret_cast<value_pointer_type>(device_space().allocate(
+              _label.c_str(), sizeof(local_value_type) << m_chunk_shift));
+      if (Kokkos::atomic_compare_exchange(&m_chunks_host[ic],
+                                          value_pointer_type(nullptr),
+                                          chunk) != nullptr) {
+        device_space().deallocate(_label.c_str(), chunk,
+                                  sizeof(local_value_type) << m_chunk_shift);
+      }
+    }
+
+    // *m_chunks_host[m_chunk_max] is the number of chunks in use, raise it
+    Kokkos::atomic_max(pc, NC);
+
+    return begin;
+  }
+
+  /** \brief  Append value from within a parallel region on the host,
+   *          return its index
+   * */
+  size_t append(typename traits::const_value_type& value) const {
+    const size_t i = grow_by(1);
+    (*this)(i)     = value;
+    return i;
+  }
+
   KOKKOS_INLINE_FUNCTION bool is_allocated() const {
     if (m_chunks_host.valid()) {
       // *m_chunks_host[m_chunk_max] stores the current number of chunks being
@@ -24,6 +24,8 @@
 #include <Kokkos_Macros.hpp>
 #include <impl/Kokkos_Functional_impl.hpp>
 
+#include <type_traits>
+
 namespace Kokkos {
 
 // These should work for most types
@@ -41,6 +43,124 @@ struct pod_hash {
   }
 };
 
+namespace Experimental {
+
+template <class T, class Abi>
+class simd;
+
+}  // namespace Experimental
+
+namespace Impl {
+
+// Integral keys zero or sign extended to 64 bits, as static_cast does
+template <typename T, typename Abi>
+KOKKOS_FORCEINLINE_FUNCTION Experimental::simd<uint64_t, Abi> simd_to_u64(
+    Experimental::simd<T, Abi> const& t) {
+  using u64_type = Experimental::simd<uint64_t, Abi>;
+  if constexpr (std::is_same_v<T, uint64_t>) {
+    return t;
+  } else if constexpr (std::is_constructible_v<u64_type,
+                                               Experimental::simd<T, Abi>>) {
+    return u64_type(t);
+  } else {
+    return u64_type([&](auto i) -> uint64_t {
+      return static_cast<uint64_t>(T(t[i]));
+    });
+  }
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/*  Hashers returning 64 bits.  Besides hashing a single key, each has a
+ *  member template hash_n that hashes a pack of integral keys,
+ *  simd<T, Abi>, at once, returning a simd<std::uint64_t, Abi> with the
+ *  same values as hashing the keys one by one.  The pack width must be
+ *  one that simd<std::uint64_t, Abi> supports.
+ */
+
+//! Multiply-xorshift hash of integral keys, the SplitMix64 finalizer.
+template <typename T>
+struct mix_hash {
+  static_assert(std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t),
+                "Kokkos::Experimental::mix_hash requires an integral key");
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  uint64_t operator()(T const& t, uint64_t seed = 0) const {
+    return Kokkos::Impl::mix64(static_cast<uint64_t>(t) ^ seed);
+  }
+
+  template <typename Abi>
+  KOKKOS_FORCEINLINE_FUNCTION simd<uint64_t, Abi> hash_n(
+      simd<T, Abi> const& t, uint64_t seed = 0) const {
+    return Kokkos::Impl::mix64(Kokkos::Impl::simd_to_u64(t) ^
+                               simd<uint64_t, Abi>(seed));
+  }
+};
+
+//! wyhash of the bytes of trivially copyable keys of any size.
+template <typename T>
+struct wy_hash {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Kokkos::Experimental::wy_hash requires a trivially copyable "
+                "key");
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  uint64_t operator()(T const& t, uint64_t seed = 0) const {
+    return Kokkos::Impl::wyhash(&t, sizeof(T), seed);
+  }
+
+  template <typename Abi>
+  KOKKOS_FORCEINLINE_FUNCTION simd<uint64_t, Abi> hash_n(
+      simd<T, Abi> const& t, uint64_t seed = 0) const {
+    static_assert(std::is_integral_v<T>,
+                  "wy_hash::hash_n requires an integral key");
+    return Kokkos::Impl::wyhash_word(Kokkos::Impl::simd_to_u64(t),
+                                     sizeof(T),
+                                     Kokkos::Impl::wyhash_seed(seed));
+  }
+};
+
+/*  CRC-32C of the bytes of trivially copyable keys, computed with the
+ *  SSE4.2 or ARMv8 CRC32 instructions on the host where available and in
+ *  software otherwise.  Cheapest on the host, but only 32 bits and linear
+ *  in the key bits, so best for keys that are already well distributed.
+ */
+template <typename T>
+struct crc32_hash {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Kokkos::Experimental::crc32_hash requires a trivially "
+                "copyable key");
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  uint64_t operator()(T const& t, uint32_t seed = 0) const {
+    return Kokkos::Impl::crc32c(&t, sizeof(T), seed);
+  }
+
+  // There is no packed CRC32 instruction, lanes are hashed in turn.
+  template <typename Abi>
+  KOKKOS_FORCEINLINE_FUNCTION simd<uint64_t, Abi> hash_n(
+      simd<T, Abi> const& t, uint32_t seed = 0) const {
+    return simd<uint64_t, Abi>([&](auto i) -> uint64_t {
+      const T key = t[i];
+      return (*this)(key, seed);
+    });
+  }
+};
+
+}  // namespace Experimental
+
+namespace Impl {
+
+// Default hasher of UnorderedMap
+template <typename T>
+using default_hash_t = std::conditional_t<std::is_integral_v<T>,
+                                          Experimental::mix_hash<T>,
+                                          pod_hash<T>>;
+
+}  // namespace Impl
+
 template <typename T>
 struct pod_equal_to {
   KOKKOS_FORCEINLINE_FUNCTION
@@ -0,0 +1,486 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_OrderedMap.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::OrderedMap.
+
+#ifndef KOKKOS_ORDERED_MAP_HPP
+#define KOKKOS_ORDERED_MAP_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_ORDEREDMAP
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Bitset.hpp>
+#include <Kokkos_Functional.hpp>
+#include <Kokkos_UnorderedMap.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class OrderedMap
+/// \brief Thread-safe lookup table that keeps its keys sorted.
+///
+/// The keys are the nodes of a skip list: every node is in the sorted
+/// list of level 0, and in the sorted lists of the levels below its
+/// height, which is about four times rarer for each level.  insert(),
+/// find(), lower_bound() and upper_bound() may be called concurrently
+/// from within a parallel kernel; lookups walk down from the top level
+/// in logarithmic expected time, and inserts link a new node into each
+/// of its levels with a compare-and-swap, bottom level first.
+///
+/// As for UnorderedMap, the capacity is fixed when the map is
+/// constructed and insert() fails once it is exhausted.  Keys are not
+/// erased; clear() empties the map.  Entries never move, so an index
+/// returned by insert() or a lookup stays valid, and next() steps from
+/// an entry to the entry with the next larger key.
+///
+/// build_from_sorted() fills the map from sorted keys in one pass of
+/// parallel kernels, without searching the lists.
+///
+/// \tparam Key Type of keys of the map.
+///
+/// \tparam Value Type of values stored in the map.  You may use \c void
+///   here, in which case the map will be a sorted set of keys.
+///
+/// \tparam Device The Kokkos Device type.
+///
+/// \tparam Compare Strict weak ordering of instances of <tt>Key</tt>.
+///   Keys for which neither compares less than the other are equal.
+template <typename Key, typename Value,
+          typename Device  = Kokkos::DefaultExecutionSpace,
+          typename Compare = Kokkos::less<Key>>
+class OrderedMap {
+ public:
+  //! \name Public types and constants
+  //@{
+  using key_type        = Key;
+  using value_type      = Value;
+  using device_type     = Device;
+  using execution_space = typename Device::execution_space;
+  using compare_type    = Compare;
+  using size_type       = uint32_t;
+
+  static constexpr bool is_set = std::is_void_v<value_type>;
+
+  using insert_result = UnorderedMapInsertResult;
+
+  static_assert(!std::is_const_v<key_type> && !std::is_const_v<value_type>,
+                "Kokkos::Experimental::OrderedMap: keys and values must not "
+                "be const");
+
+  //! Height of the head of the lists, enough for 4^16 keys
+  enum : size_type { max_height = 16 };
+  //@}
+
+ private:
+  enum : size_type { invalid_index = ~static_cast<size_type>(0) };
+
+  using impl_value_type = std::conditional_t<is_set, int, value_type>;
+
+  using key_type_view   = View<key_type *, device_type>;
+  using value_type_view = View<impl_value_type *, device_type>;
+  using size_type_view  = View<size_type *, device_type>;
+  using bitset_type     = Bitset<device_type>;
+
+  enum { next_node_idx = 0, failed_insert_idx = 1 };
+  enum { num_scalars = 2 };
+  using scalars_view = View<size_type[num_scalars], LayoutLeft, device_type>;
+
+ public:
+  //! \name Public member functions
+  //@{
+
+  /// \brief Constructor
+  ///
+  /// \param capacity [in] Maximum number of keys the map can hold.
+  /// \param compare  [in] The ordering of keys.
+  OrderedMap(size_type capacity = 0, compare_type compare = compare_type())
+      : m_compare(compare) {
+    const std::string label("OrderedMap");
+
+    m_valid   = bitset_type(view_alloc(label + " - valid"), capacity);
+    m_keys    = key_type_view(label + " - keys", capacity);
+    m_values  = value_type_view(label + " - values", is_set ? 0 : capacity);
+    m_scalars = scalars_view(label + " - scalars");
+
+    // The next pointers of a node are stored contiguously, starting at its
+    // offset.  The head of the lists, with max_height levels, follows the
+    // last node.
+    m_offsets = size_type_view(view_alloc(WithoutInitializing,
+                                          label + " - offsets"),
+                               capacity + 2);
+    const size_type_view offsets = m_offsets;
+    size_type num_next           = 0;
+    parallel_scan(
+        "Kokkos::OrderedMap::offsets",
+        RangePolicy<execution_space>(0, capacity + 1),
+        KOKKOS_LAMBDA(size_type i, size_type & update, bool final) {
+          const size_type height =
+              i < capacity ? OrderedMap::node_height(i) : max_height;
+          if (final) offsets(i) = update;
+          update += height;
+          if (final && i == capacity) offsets(i + 1) = update;
+        },
+        num_next);
+
+    m_next = size_type_view(view_alloc(WithoutInitializing,
+                                       label + " - next index"),
+                            num_next);
+    Kokkos::deep_copy(m_next, invalid_index);
+  }
+
+  //! Clear all entries in the map.
+  void clear() {
+    if (!is_allocated()) return;
+    m_valid.clear();
+    Kokkos::deep_copy(m_next, invalid_index);
+    Kokkos::deep_copy(m_scalars, 0);
+  }
+
+  KOKKOS_INLINE_FUNCTION constexpr bool is_allocated() const {
+    return m_next.is_allocated();
+  }
+
+  /// \brief The maximum number of entries that the map can hold.
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.
+  KOKKOS_FORCEINLINE_FUNCTION
+  size_type capacity() const { return m_keys.extent(0); }
+
+  /// \brief The number of entries in the map.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be called in
+  /// a parallel kernel.
+  size_type size() const { return m_valid.count(); }
+
+  /// \brief Whether an insert() failed because the map was full.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be called in
+  /// a parallel kernel.
+  bool failed_insert() const { return get_scalar(failed_insert_idx) != 0; }
+
+  /// \brief Insert the given key/value pair into the map.
+  ///
+  /// This <i>is</i> a device function; it may be called in a parallel
+  /// kernel.  If the key is already present its value is left in place
+  /// and the result is existing().
+  KOKKOS_INLINE_FUNCTION
+  insert_result insert(key_type const &k,
+                       impl_value_type const &v = impl_value_type()) const {
+    insert_result result;
+
+    if (!is_allocated()) return result;
+
+    size_type preds[max_height];
+    size_type succs[max_height];
+    size_type node = invalid_index;
+
+    // Link the node into level 0, which makes it part of the map
+    for (;;) {
+      result.increment_list_position();
+      locate(k, preds, succs);
+
+      if (succs[0] != invalid_index && !m_compare(k, m_keys(succs[0]))) {
+        // A node claimed before losing the race for the key stays unused
+        result.set_existing(succs[0], node != invalid_index);
+        return result;
+      }
+
+      if (node == invalid_index) {
+        node = atomic_fetch_add(&m_scalars(next_node_idx), 1);
+        if (node >= capacity()) {
+          if (!m_scalars(failed_insert_idx)) {
+            m_scalars(failed_insert_idx) = true;
+          }
+          return result;
+        }
+        m_keys(node) = k;
+        if constexpr (!is_set) m_values(node) = v;
+      }
+
+      *next_ptr(node, 0) = succs[0];
+      Kokkos::memory_fence();
+      if (succs[0] == atomic_compare_exchange(next_ptr(preds[0], 0),
+                                              succs[0], node)) {
+        break;
+      }
+    }
+
+    m_valid.set(node);
+    result.set_success(node);
+
+    // Link the levels above, which only shorten searches
+    const size_type height = node_height(node);
+    for (size_type level = 1; level < height; ++level) {
+      for (;;) {
+        *next_ptr(node, level) = succs[level];
+        Kokkos::memory_fence();
+        if (succs[level] == atomic_compare_exchange(next_ptr(preds[level],
+                                                             level),
+                                                    succs[level], node)) {
+          break;
+        }
+        locate(k, preds, succs);
+      }
+    }
+
+    return result;
+  }
+
+  /// \brief Find the given key \c k, if it exists in the map.
+  ///
+  /// \return The index of the entry with key \c k, or an invalid index if
+  ///   there is none; check with valid_at().
+  KOKKOS_INLINE_FUNCTION
+  size_type find(const key_type &k) const {
+    const size_type i = lower_bound(k);
+    return (i != invalid_index && !m_compare(k, m_keys(i))) ? i
+                                                            : invalid_index;
+  }
+
+  /// \brief Does the key exist in the map
+  KOKKOS_INLINE_FUNCTION
+  bool exists(const key_type &k) const { return valid_at(find(k)); }
+
+  /// \brief Index of the entry with the smallest key not less than \c k,
+  ///   or an invalid index if there is none.
+  KOKKOS_INLINE_FUNCTION
+  size_type lower_bound(const key_type &k) const { return bound<false>(k); }
+
+  /// \brief Index of the entry with the smallest key greater than \c k,
+  ///   or an invalid index if there is none.
+  KOKKOS_INLINE_FUNCTION
+  size_type upper_bound(const key_type &k) const { return bound<true>(k); }
+
+  /// \brief Index of the entry with the smallest key, or an invalid index
+  ///   if the map is empty.
+  KOKKOS_INLINE_FUNCTION
+  size_type first() const {
+    return is_allocated() ? load(next_ptr(capacity(), 0)) : invalid_index;
+  }
+
+  /// \brief Index of the entry following entry \c i in key order, or an
+  ///   invalid index if \c i has the largest key.
+  KOKKOS_INLINE_FUNCTION
+  size_type next(size_type i) const { return load(next_ptr(i, 0)); }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  bool valid_at(size_type i) const { return m_valid.test(i); }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  key_type key_at(size_type i) const { return m_keys(i); }
+
+  template <typename Dummy = value_type>
+  KOKKOS_FORCEINLINE_FUNCTION std::enable_if_t<
+      !std::is_void_v<Dummy>, std::add_lvalue_reference_t<impl_value_type>>
+  value_at(size_type i) const {
+    return m_values(i);
+  }
+
+  /// \brief Replace the contents of the map by the entries
+  ///   <tt>(keys(i), values(i))</tt>.
+  ///
+  /// The keys must be sorted and unique.  Entry \c i is stored at index
+  /// \c i, and the lists of all levels are linked directly.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be called in
+  /// a parallel kernel.
+  template <typename KeyViewType, typename ValueViewType>
+  void build_from_sorted(KeyViewType const &keys,
+                         ValueViewType const &values) {
+    static_assert(!is_set, "Use build_from_sorted(keys) for sets");
+    if (values.extent(0) != keys.extent(0)) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::OrderedMap::build_from_sorted: keys and "
+          "values differ in length");
+    }
+    impl_build_from_sorted(keys, values);
+  }
+
+  template <typename KeyViewType>
+  void build_from_sorted(KeyViewType const &keys) {
+    static_assert(is_set, "Use build_from_sorted(keys, values) for maps");
+    impl_build_from_sorted(keys, value_type_view());
+  }
+  //@}
+
+ private:
+  // Heights are geometrically distributed with ratio 1/4, and only depend
+  // on the index of the node.
+  KOKKOS_INLINE_FUNCTION
+  static size_type node_height(size_type i) {
+    const uint64_t bits =
+        Kokkos::Impl::mix64(uint64_t(i) ^ 0x9e3779b97f4a7c15ull) |
+        (uint64_t(1) << 62);
+    const size_type height = 1 + Kokkos::countr_zero(bits) / 2;
+    return height < size_type(max_height) ? height : size_type(max_height);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  size_type *next_ptr(size_type node, size_type level) const {
+    return m_next.data() + m_offsets(node) + level;
+  }
+
+  template <typename T>
+  KOKKOS_FORCEINLINE_FUNCTION static T load(T *ptr) {
+    // FIXME_SYCL replacement for memory_fence
+#ifdef KOKKOS_ENABLE_SYCL
+    return Kokkos::atomic_load(ptr);
+#else
+    return volatile_load(ptr);
+#endif
+  }
+
+  // Predecessor and successor of k on every level, the successor being
+  // the first node whose key is not less than k
+  KOKKOS_INLINE_FUNCTION
+  void locate(key_type const &k, size_type *preds, size_type *succs) const {
+    size_type pred = capacity();
+    for (int level = max_height - 1; level >= 0; --level) {
+      size_type curr = load(next_ptr(pred, level));
+      while (curr != invalid_index && m_compare(m_keys(curr), k)) {
+        pred = curr;
+        curr = load(next_ptr(curr, level));
+      }
+      preds[level] = pred;
+      succs[level] = curr;
+    }
+  }
+
+  template <bool Upper>
+  KOKKOS_INLINE_FUNCTION size_type bound(key_type const &k) const {
+    if (!is_allocated()) return invalid_index;
+    size_type pred = capacity();
+    size_type curr = invalid_index;
+    for (int level = max_height - 1; level >= 0; --level) {
+      curr = load(next_ptr(pred, level));
+      while (curr != invalid_index &&
+             (Upper ? !m_compare(k, m_keys(curr))
+                    : m_compare(m_keys(curr), k))) {
+        pred = curr;
+        curr = load(next_ptr(curr, level));
+      }
+    }
+    return curr;
+  }
+
+  template <typename KeyViewType, typename ValueViewType>
+  void impl_build_from_sorted(KeyViewType const &keys,
+                              ValueViewType const &values) {
+    using policy_type = RangePolicy<execution_space>;
+
+    const size_type n = keys.extent(0);
+    if (n > capacity()) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::OrderedMap::build_from_sorted: " +
+          std::to_string(n) + " keys exceed the capacity " +
+          std::to_string(capacity()));
+    }
+
+    clear();
+    if (n == 0) return;
+
+    const OrderedMap map = *this;
+
+    size_type unsorted = 0;
+    parallel_reduce(
+        "Kokkos::OrderedMap::build_keys", policy_type(0, n),
+        KOKKOS_LAMBDA(size_type i, size_type & update) {
+          map.m_keys(i) = keys(i);
+          if constexpr (!is_set) map.m_values(i) = values(i);
+          map.m_valid.set(i);
+          if (i > 0 && !map.m_compare(keys(i - 1), keys(i))) ++update;
+        },
+        unsorted);
+
+    if (unsorted) {
+      clear();
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::OrderedMap::build_from_sorted: keys are "
+          "not sorted and unique");
+    }
+
+    // Every node is on level 0.  The nodes of each level above are
+    // compacted in key order from the nodes of the level below with a
+    // scan, and consecutive nodes of a level are linked.
+    size_type_view nodes(
+        view_alloc(WithoutInitializing, "OrderedMap - level nodes"), n);
+    size_type_view above(
+        view_alloc(WithoutInitializing, "OrderedMap - level nodes"), n);
+    parallel_for(
+        "Kokkos::OrderedMap::build_links", policy_type(0, n),
+        KOKKOS_LAMBDA(size_type i) {
+          nodes(i)                                         = i;
+          *map.next_ptr(i > 0 ? i - 1 : map.capacity(), 0) = i;
+        });
+
+    size_type count = n;
+    for (size_type level = 1; level < max_height && count > 0; ++level) {
+      size_type level_count = 0;
+      parallel_scan(
+          "Kokkos::OrderedMap::build_levels", policy_type(0, count),
+          KOKKOS_LAMBDA(size_type k, size_type & update, bool final) {
+            const size_type node = nodes(k);
+            if (OrderedMap::node_height(node) > level) {
+              if (final) above(update) = node;
+              ++update;
+            }
+          },
+          level_count);
+      parallel_for(
+          "Kokkos::OrderedMap::build_links", policy_type(0, level_count),
+          KOKKOS_LAMBDA(size_type k) {
+            *map.next_ptr(k > 0 ? above(k - 1) : map.capacity(), level) =
+                above(k);
+          });
+      std::swap(nodes, above);
+      count = level_count;
+    }
+
+    Kokkos::deep_copy(Kokkos::subview(m_scalars, int(next_node_idx)), n);
+  }
+
+  size_type get_scalar(int i) const {
+    size_type result = 0;
+    Kokkos::deep_copy(result, Kokkos::subview(m_scalars, i));
+    return result;
+  }
+
+ private:  // private members
+  bitset_type m_valid;
+  key_type_view m_keys;
+  value_type_view m_values;
+  size_type_view m_offsets;
+  size_type_view m_next;
+  scalars_view m_scalars;
+  compare_type m_compare;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_ORDEREDMAP
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_ORDEREDMAP
+#endif
+#endif  // KOKKOS_ORDERED_MAP_HPP
@@ -181,6 +181,14 @@ struct UnorderedMapInsertOpTypes {
 ///      ignored and the old value was left in place. </li>
 /// </ol>
 ///
+/// A map may instead be made growable with reserve_growth(), which
+/// allocates a second, larger table up front.  Once the original table
+/// is full, insert() links its buckets into the larger table one at a
+/// time and places new keys there.  Entries never move, so indexes
+/// returned by insert() and find() stay valid, and so do lookups while
+/// buckets are being linked.  The combined capacity is available without
+/// a host round-trip; rehash() later folds both tables into one.
+///
 /// \tparam Key Type of keys of the lookup table.  If \c const, users
 ///   are not allowed to add or remove keys, though they are allowed
 ///   to change values.  In that case, the implementation may make
@@ -198,14 +206,16 @@ struct UnorderedMapInsertOpTypes {
 /// \tparam Device The Kokkos Device type.
 ///
 /// \tparam Hasher Definition of the hash function for instances of
-///   <tt>Key</tt>.  The default will calculate a bitwise hash.
+///   <tt>Key</tt>.  The default will calculate a multiply-xorshift hash
+///   of integral keys and a bitwise hash of other keys.  Hashes are
+///   truncated to \c size_type.
 ///
 /// \tparam EqualTo Definition of the equality function for instances of
 ///   <tt>Key</tt>.  The default will do a bitwise equality comparison.
 ///
 template <typename Key, typename Value,
           typename Device  = Kokkos::DefaultExecutionSpace,
-          typename Hasher  = pod_hash<std::remove_const_t<Key>>,
+          typename Hasher  = Impl::default_hash_t<std::remove_const_t<Key>>,
           typename EqualTo = pod_equal_to<std::remove_const_t<Key>>>
 class UnorderedMap {
  private:
@@ -265,6 +275,11 @@ class UnorderedMap {
  private:
   enum : size_type { invalid_index = ~static_cast<size_type>(0) };
 
+  // Terminates a hash list of the original table of a growable map once
+  // that list has been linked into the growth table; inserts that reach
+  // it continue in the growth table.
+  enum : size_type { sealed_index = invalid_index - 1 };
+
   using impl_value_type = std::conditional_t<is_set, int, declared_value_type>;
 
   using key_type_view = std::conditional_t<
@@ -284,7 +299,8 @@ class UnorderedMap {
                                          ConstBitset<Device>>;
 
   enum { modified_idx = 0, erasable_idx = 1, failed_insert_idx = 2 };
-  enum { num_scalars = 3 };
+  enum { growing_idx = 3, migrated_idx = 4, migrate_cursor_idx = 5 };
+  enum { num_scalars = 6 };
   using scalars_view = View<int[num_scalars], LayoutLeft, device_type>;
 
  public:
@@ -393,6 +409,14 @@ class UnorderedMap {
       const key_type tmp = key_type();
       Kokkos::deep_copy(m_keys, tmp);
     }
+    if (m_grow_available_indexes.size()) {
+      m_grow_available_indexes.clear();
+      m_grow_migrated.clear();
+      Kokkos::deep_copy(m_grow_hash_lists, invalid_index);
+      Kokkos::deep_copy(m_grow_next_index, invalid_index);
+      const key_type tmp = key_type();
+      Kokkos::deep_copy(m_grow_keys, tmp);
+    }
     Kokkos::deep_copy(m_scalars, 0);
     m_size() = 0;
   }
@@ -433,11 +457,59 @@ class UnorderedMap {
     }
     tmp.m_bounded_insert = bounded_insert;
 
+    if (m_grow_available_indexes.size()) tmp.reserve_growth();
+
     *this = tmp;
 
     return true;
   }
 
+  /// \brief Make the map growable.
+  ///
+  /// Allocates a growth table with room for \c growth_capacity_hint
+  /// entries, by default the current capacity.  Once the map is full,
+  /// insert() continues in the growth table as described in the class
+  /// documentation and capacity() includes both tables.  A map that is
+  /// already growing is first rehashed into a single table.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  void reserve_growth(size_type growth_capacity_hint = 0) {
+    if (!is_insertable_map) return;
+
+    if (growing()) rehash(capacity());
+
+    const size_type primary_capacity = m_available_indexes.size();
+    const size_type growth_capacity  = calculate_capacity(
+        growth_capacity_hint ? growth_capacity_hint : primary_capacity);
+
+    m_grow_available_indexes = bitset_type(
+        view_alloc("UnorderedMap - growth bitset"), growth_capacity);
+    m_grow_migrated = bitset_type(view_alloc("UnorderedMap - migrated lists"),
+                                  m_hash_lists.extent(0));
+    m_grow_hash_lists = size_type_view(
+        view_alloc(WithoutInitializing, "UnorderedMap - growth hash list"),
+        Impl::find_hash_size(primary_capacity + growth_capacity));
+    // Indexes of both tables, +1 as for m_next_index
+    m_grow_next_index = size_type_view(
+        view_alloc(WithoutInitializing, "UnorderedMap - growth next index"),
+        primary_capacity + growth_capacity + 1);
+    m_grow_keys = key_type_view("UnorderedMap - growth keys", growth_capacity);
+    m_grow_values = value_type_view("UnorderedMap - growth values",
+                                    is_set ? 0 : growth_capacity);
+
+    Kokkos::deep_copy(m_grow_hash_lists, invalid_index);
+    Kokkos::deep_copy(m_grow_next_index, invalid_index);
+  }
+
+  /// \brief Whether inserts have continued in the growth table.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.
+  bool growing() const {
+    return m_grow_available_indexes.size() && get_flag(growing_idx);
+  }
+
   /// \brief The number of entries in the table.
   ///
   /// This method has undefined behavior when erasable() is true.
@@ -449,6 +521,9 @@ class UnorderedMap {
     if (capacity() == 0u) return 0u;
     if (modified()) {
       m_size() = m_available_indexes.count();
+      if (m_grow_available_indexes.size()) {
+        m_size() += m_grow_available_indexes.count();
+      }
       reset_flag(modified_idx);
     }
     return m_size();
@@ -468,6 +543,8 @@ class UnorderedMap {
   bool begin_erase() {
     bool result = !erasable();
     if (is_insertable_map && result) {
+      // Erasing compacts the hash lists of a single table
+      if (growing()) rehash(capacity());
       execution_space().fence(
           "Kokkos::UnorderedMap::begin_erase: fence before setting erasable "
           "flag");
@@ -495,7 +572,9 @@ class UnorderedMap {
   /// This <i>is</i> a device function; it may be called in a parallel
   /// kernel.
   KOKKOS_FORCEINLINE_FUNCTION
-  size_type capacity() const { return m_available_indexes.size(); }
+  size_type capacity() const {
+    return m_available_indexes.size() + m_grow_available_indexes.size();
+  }
 
   /// \brief The number of hash table "buckets."
   ///
@@ -544,9 +623,15 @@ class UnorderedMap {
       m_scalars((int)modified_idx) = true;
     }
 
+    const bool growable = m_grow_available_indexes.size() != 0u;
+
+    if (growable && m_scalars((int)growing_idx)) {
+      return grow_insert(k, v, arg_insert_op);
+    }
+
     int volatile &failed_insert_ref = m_scalars((int)failed_insert_idx);
 
-    const size_type hash_value = m_hasher(k);
+    const size_type hash_value = static_cast<size_type>(m_hasher(k));
     const size_type hash_list  = hash_value % m_hash_lists.extent(0);
 
     size_type *curr_ptr = &m_hash_lists[hash_list];
@@ -554,7 +639,8 @@ class UnorderedMap {
 
     // Force integer multiply to long
     size_type index_hint = static_cast<size_type>(
-        (static_cast<double>(hash_list) * capacity()) / m_hash_lists.extent(0));
+        (static_cast<double>(hash_list) * m_available_indexes.size()) /
+        m_hash_lists.extent(0));
 
     size_type find_attempts = 0;
 
@@ -582,12 +668,11 @@ class UnorderedMap {
       size_type curr = volatile_load(curr_ptr);
 #endif
 
-      KOKKOS_NONTEMPORAL_PREFETCH_LOAD(
-          &m_keys[curr != invalid_index ? curr : 0]);
+      KOKKOS_NONTEMPORAL_PREFETCH_LOAD(&m_keys[curr < sealed_index ? curr : 0]);
 #if defined(__MIC__)
 #pragma noprefetch
 #endif
-      while (curr != invalid_index && !m_equal_to(
+      while (curr < sealed_index && !m_equal_to(
 #ifdef KOKKOS_ENABLE_SYCL
                                           Kokkos::atomic_load(&m_keys[curr])
 #else
@@ -604,12 +689,18 @@ class UnorderedMap {
         curr = volatile_load(curr_ptr);
 #endif
         KOKKOS_NONTEMPORAL_PREFETCH_LOAD(
-            &m_keys[curr != invalid_index ? curr : 0]);
+            &m_keys[curr < sealed_index ? curr : 0]);
       }
 
+      //------------------------------------------------------------
+      // The list was linked into the growth table, continue there.
+      if (curr == sealed_index) {
+        if (new_index != invalid_index) m_available_indexes.reset(new_index);
+        return grow_insert(k, v, arg_insert_op);
+      }
       //------------------------------------------------------------
       // If key already present then return that index.
-      if (curr != invalid_index) {
+      else if (curr != invalid_index) {
         const bool free_existing = new_index != invalid_index;
         if (free_existing) {
           // Previously claimed an unused entry that was not inserted.
@@ -639,6 +730,11 @@ class UnorderedMap {
 
           // found and index and this thread set it
           if (!found && ++find_attempts >= max_attempts) {
+            if (growable) {
+              // The table is full, start growing
+              m_scalars((int)growing_idx) = true;
+              return grow_insert(k, v, arg_insert_op);
+            }
             failed_insert_ref = true;
             not_done          = false;
           } else if (m_available_indexes.set(index_hint)) {
@@ -687,6 +783,42 @@ class UnorderedMap {
     return result;
   }
 
+  /// \brief Insert a batch of keys and values.
+  ///
+  /// Equivalent to calling insert(keys(i), values(i), insert_op) for all
+  /// \c i in a parallel_for on \c exec and storing the result in
+  /// <tt>results(i)</tt>, but the batch is first hashed and grouped by
+  /// hash list so that the table is accessed in a cache friendly order.
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.  It is asynchronous with respect to
+  /// \c exec.
+  template <typename ExecSpace, typename KeysView, typename ValuesView,
+            typename ResultsView, typename InsertOpType = default_op_type>
+  void insert_bulk(ExecSpace const &exec, KeysView const &keys,
+                   ValuesView const &values, ResultsView const &results,
+                   InsertOpType const &insert_op = InsertOpType()) const {
+    static_assert(!is_set, "Use insert_bulk(exec, keys, results) for sets.");
+    KOKKOS_EXPECTS(values.extent(0) == keys.extent(0) &&
+                   results.extent(0) == keys.extent(0));
+
+    Impl::UnorderedMapBulk<declared_map_type, ExecSpace> bulk(exec, *this,
+                                                              keys);
+    bulk.insert(exec, *this, keys, values, results, insert_op);
+  }
+
+  /// \brief Insert a batch of keys into a set, see the overload above.
+  template <typename ExecSpace, typename KeysView, typename ResultsView>
+  void insert_bulk(ExecSpace const &exec, KeysView const &keys,
+                   ResultsView const &results) const {
+    static_assert(is_set, "Use insert_bulk(exec, keys, values, results).");
+    KOKKOS_EXPECTS(results.extent(0) == keys.extent(0));
+
+    Impl::UnorderedMapBulk<declared_map_type, ExecSpace> bulk(exec, *this,
+                                                              keys);
+    bulk.insert(exec, *this, keys, keys, results, default_op_type());
+  }
+
   KOKKOS_INLINE_FUNCTION
   bool erase(key_type const &k) const {
     bool result = false;
@@ -698,7 +830,12 @@ class UnorderedMap {
 
       size_type index = find(k);
       if (valid_at(index)) {
-        m_available_indexes.reset(index);
+        const size_type primary_capacity = m_available_indexes.size();
+        if (index < primary_capacity) {
+          m_available_indexes.reset(index);
+        } else {
+          m_grow_available_indexes.reset(index - primary_capacity);
+        }
         result = true;
       }
     }
@@ -715,18 +852,53 @@ class UnorderedMap {
   /// kernel.
   KOKKOS_INLINE_FUNCTION
   size_type find(const key_type &k) const {
-    size_type curr = 0u < capacity()
-                         ? m_hash_lists(m_hasher(k) % m_hash_lists.extent(0))
-                         : invalid_index;
-
-    KOKKOS_NONTEMPORAL_PREFETCH_LOAD(&m_keys[curr != invalid_index ? curr : 0]);
-    while (curr != invalid_index && !m_equal_to(m_keys[curr], k)) {
-      KOKKOS_NONTEMPORAL_PREFETCH_LOAD(
-          &m_keys[curr != invalid_index ? curr : 0]);
+    if (capacity() == 0u) return invalid_index;
+
+    const size_type hash_value = static_cast<size_type>(m_hasher(k));
+    const size_type hash_list  = hash_value % m_hash_lists.extent(0);
+
+    // Every key is either in a list of the original table or stored in
+    // the growth table, whose lists also hold the linked original lists.
+    if (m_grow_available_indexes.size() && m_scalars((int)growing_idx)) {
+      size_type curr =
+          m_grow_hash_lists(hash_value % m_grow_hash_lists.extent(0));
+      while (curr != invalid_index && !m_equal_to(key_at(curr), k)) {
+        curr = m_grow_next_index[curr];
+      }
+      if (curr != invalid_index ||
+          m_scalars((int)migrated_idx) == int(m_hash_lists.extent(0)) ||
+          m_grow_migrated.test(hash_list)) {
+        return curr;
+      }
+    }
+
+    size_type curr = m_hash_lists(hash_list);
+
+    KOKKOS_NONTEMPORAL_PREFETCH_LOAD(&m_keys[curr < sealed_index ? curr : 0]);
+    while (curr < sealed_index && !m_equal_to(m_keys[curr], k)) {
+      KOKKOS_NONTEMPORAL_PREFETCH_LOAD(&m_keys[curr < sealed_index ? curr : 0]);
       curr = m_next_index[curr];
     }
 
-    return curr;
+    return curr < sealed_index ? curr : invalid_index;
+  }
+
+  /// \brief Find a batch of keys.
+  ///
+  /// Stores find(keys(i)) in <tt>indices(i)</tt>, probing the table in the
+  /// same order as insert_bulk().
+  ///
+  /// This is <i>not</i> a device function; it may <i>not</i> be
+  /// called in a parallel kernel.  It is asynchronous with respect to
+  /// \c exec.
+  template <typename ExecSpace, typename KeysView, typename IndicesView>
+  void find_bulk(ExecSpace const &exec, KeysView const &keys,
+                 IndicesView const &indices) const {
+    KOKKOS_EXPECTS(indices.extent(0) == keys.extent(0));
+
+    Impl::UnorderedMapBulk<declared_map_type, ExecSpace> bulk(exec, *this,
+                                                              keys);
+    bulk.find(exec, *this, keys, indices);
   }
 
   /// \brief Does the key exist in the map
@@ -750,7 +922,9 @@ class UnorderedMap {
       std::conditional_t<has_const_value, impl_value_type, impl_value_type &>>
   value_at(size_type i) const {
     KOKKOS_EXPECTS(i < capacity());
-    return m_values[i];
+    const size_type primary_capacity = m_available_indexes.size();
+    return i < primary_capacity ? m_values[i]
+                                : m_grow_values[i - primary_capacity];
   }
 
   /// \brief Get the key with \c i as its direct index.
@@ -762,11 +936,17 @@ class UnorderedMap {
   KOKKOS_FORCEINLINE_FUNCTION
   key_type key_at(size_type i) const {
     KOKKOS_EXPECTS(i < capacity());
-    return m_keys[i];
+    const size_type primary_capacity = m_available_indexes.size();
+    return i < primary_capacity ? m_keys[i] : m_grow_keys[i - primary_capacity];
   }
 
   KOKKOS_FORCEINLINE_FUNCTION
-  bool valid_at(size_type i) const { return m_available_indexes.test(i); }
+  bool valid_at(size_type i) const {
+    const size_type primary_capacity = m_available_indexes.size();
+    return i < primary_capacity
+               ? m_available_indexes.test(i)
+               : m_grow_available_indexes.test(i - primary_capacity);
+  }
 
   template <typename SKey, typename SValue>
   UnorderedMap(
@@ -784,7 +964,13 @@ class UnorderedMap {
         m_next_index(src.m_next_index),
         m_keys(src.m_keys),
         m_values(src.m_values),
-        m_scalars(src.m_scalars) {}
+        m_scalars(src.m_scalars),
+        m_grow_available_indexes(src.m_grow_available_indexes),
+        m_grow_migrated(src.m_grow_migrated),
+        m_grow_hash_lists(src.m_grow_hash_lists),
+        m_grow_next_index(src.m_grow_next_index),
+        m_grow_keys(src.m_grow_keys),
+        m_grow_values(src.m_grow_values) {}
 
   template <typename SKey, typename SValue>
   std::enable_if_t<
@@ -792,16 +978,22 @@ class UnorderedMap {
                                   SValue>::value,
       declared_map_type &>
   operator=(UnorderedMap<SKey, SValue, Device, Hasher, EqualTo> const &src) {
-    m_bounded_insert    = src.m_bounded_insert;
-    m_hasher            = src.m_hasher;
-    m_equal_to          = src.m_equal_to;
-    m_size              = src.m_size;
-    m_available_indexes = src.m_available_indexes;
-    m_hash_lists        = src.m_hash_lists;
-    m_next_index        = src.m_next_index;
-    m_keys              = src.m_keys;
-    m_values            = src.m_values;
-    m_scalars           = src.m_scalars;
+    m_bounded_insert         = src.m_bounded_insert;
+    m_hasher                 = src.m_hasher;
+    m_equal_to               = src.m_equal_to;
+    m_size                   = src.m_size;
+    m_available_indexes      = src.m_available_indexes;
+    m_hash_lists             = src.m_hash_lists;
+    m_next_index             = src.m_next_index;
+    m_keys                   = src.m_keys;
+    m_values                 = src.m_values;
+    m_scalars                = src.m_scalars;
+    m_grow_available_indexes = src.m_grow_available_indexes;
+    m_grow_migrated          = src.m_grow_migrated;
+    m_grow_hash_lists        = src.m_grow_hash_lists;
+    m_grow_next_index        = src.m_grow_next_index;
+    m_grow_keys              = src.m_grow_keys;
+    m_grow_values            = src.m_grow_values;
     return *this;
   }
 
@@ -846,6 +1038,24 @@ class UnorderedMap {
                         src.m_values.extent(0));
     tmp.m_scalars = scalars_view("UnorderedMap scalars");
 
+    if (src.m_grow_available_indexes.size()) {
+      tmp.m_grow_available_indexes =
+          bitset_type(src.m_grow_available_indexes.size());
+      tmp.m_grow_migrated   = bitset_type(src.m_grow_migrated.size());
+      tmp.m_grow_hash_lists = size_type_view(
+          view_alloc(WithoutInitializing, "UnorderedMap growth hash list"),
+          src.m_grow_hash_lists.extent(0));
+      tmp.m_grow_next_index = size_type_view(
+          view_alloc(WithoutInitializing, "UnorderedMap growth next index"),
+          src.m_grow_next_index.extent(0));
+      tmp.m_grow_keys = key_type_view(
+          view_alloc(WithoutInitializing, "UnorderedMap growth keys"),
+          src.m_grow_keys.extent(0));
+      tmp.m_grow_values = value_type_view(
+          view_alloc(WithoutInitializing, "UnorderedMap growth values"),
+          src.m_grow_values.extent(0));
+    }
+
     *this = tmp;
   }
 
@@ -891,6 +1101,22 @@ class UnorderedMap {
       raw_deep_copy(m_scalars.data(), src.m_scalars.data(),
                     sizeof(int) * num_scalars);
 
+      if (src.m_grow_available_indexes.size()) {
+        Kokkos::deep_copy(m_grow_available_indexes,
+                          src.m_grow_available_indexes);
+        Kokkos::deep_copy(m_grow_migrated, src.m_grow_migrated);
+        raw_deep_copy(m_grow_hash_lists.data(), src.m_grow_hash_lists.data(),
+                      sizeof(size_type) * src.m_grow_hash_lists.extent(0));
+        raw_deep_copy(m_grow_next_index.data(), src.m_grow_next_index.data(),
+                      sizeof(size_type) * src.m_grow_next_index.extent(0));
+        raw_deep_copy(m_grow_keys.data(), src.m_grow_keys.data(),
+                      sizeof(key_type) * src.m_grow_keys.extent(0));
+        if (!is_set) {
+          raw_deep_copy(m_grow_values.data(), src.m_grow_values.data(),
+                        sizeof(impl_value_type) * src.m_grow_values.extent(0));
+        }
+      }
+
       Kokkos::fence(
           "Kokkos::UnorderedMap::deep_copy_view: fence after copy to dst.");
     }
@@ -943,6 +1169,175 @@ class UnorderedMap {
                : 128u;
   }
 
+  template <typename T>
+  KOKKOS_FORCEINLINE_FUNCTION static T load(T *ptr) {
+    // FIXME_SYCL replacement for memory_fence
+#ifdef KOKKOS_ENABLE_SYCL
+    return Kokkos::atomic_load(ptr);
+#else
+    return volatile_load(ptr);
+#endif
+  }
+
+  // Key at an index of either table, for traversing the growth table
+  KOKKOS_FORCEINLINE_FUNCTION
+  key_type grow_key_at(size_type i) const {
+    const size_type primary_capacity = m_available_indexes.size();
+    return i < primary_capacity ? load(&m_keys[i])
+                                : load(&m_grow_keys[i - primary_capacity]);
+  }
+
+  /// Link the entries of list \c hash_list of the original table into the
+  /// growth table and seal the list so that it is no longer appended to.
+  /// Threads may do this concurrently for the same list; each returns
+  /// only once all entries are linked, so no thread waits on another.
+  KOKKOS_INLINE_FUNCTION
+  void migrate_list(size_type hash_list) const {
+    if (m_grow_migrated.test(hash_list)) return;
+
+    size_type *curr_ptr = &m_hash_lists[hash_list];
+    for (;;) {
+      const size_type curr = load(curr_ptr);
+      if (curr == sealed_index) break;
+      if (curr == invalid_index) {
+        if (invalid_index ==
+            atomic_compare_exchange(curr_ptr, curr,
+                                    static_cast<size_type>(sealed_index))) {
+          break;
+        }
+        continue;
+      }
+      link_entry(curr);
+      curr_ptr = &m_next_index[curr];
+    }
+
+    if (m_grow_migrated.set(hash_list)) {
+      atomic_increment(&m_scalars((int)migrated_idx));
+    }
+  }
+
+  // Append entry i of the original table to its growth table list unless
+  // another thread already did.
+  KOKKOS_INLINE_FUNCTION
+  void link_entry(size_type i) const {
+    const key_type k    = load(&m_keys[i]);
+    size_type *curr_ptr =
+        &m_grow_hash_lists[static_cast<size_type>(m_hasher(k)) %
+                           m_grow_hash_lists.extent(0)];
+    for (;;) {
+      size_type curr = load(curr_ptr);
+      while (curr != invalid_index && curr != i &&
+             !m_equal_to(grow_key_at(curr), k)) {
+        curr_ptr = &m_grow_next_index[curr];
+        curr     = load(curr_ptr);
+      }
+      if (curr != invalid_index) return;
+      if (curr == atomic_compare_exchange(curr_ptr, curr, i)) return;
+    }
+  }
+
+  /// Insert into the growth table.  The list of the original table that
+  /// \c k hashes to is linked first, so a key is never inserted in both
+  /// tables, and one further list is linked to make progress on the
+  /// migration.
+  template <typename InsertOpType>
+  KOKKOS_INLINE_FUNCTION insert_result
+  grow_insert(key_type const &k, impl_value_type const &v,
+              [[maybe_unused]] InsertOpType arg_insert_op) const {
+    insert_result result;
+
+    const size_type hash_value = static_cast<size_type>(m_hasher(k));
+    const size_type num_lists  = m_hash_lists.extent(0);
+
+    migrate_list(hash_value % num_lists);
+    if (m_scalars((int)migrated_idx) < int(num_lists)) {
+      const size_type next_list =
+          atomic_fetch_add(&m_scalars((int)migrate_cursor_idx), 1);
+      if (next_list < num_lists) migrate_list(next_list);
+    }
+
+    int volatile &failed_insert_ref = m_scalars((int)failed_insert_idx);
+
+    const size_type primary_capacity = m_available_indexes.size();
+    const size_type hash_list = hash_value % m_grow_hash_lists.extent(0);
+
+    size_type *curr_ptr = &m_grow_hash_lists[hash_list];
+    size_type new_index = invalid_index;
+
+    size_type index_hint = static_cast<size_type>(
+        (static_cast<double>(hash_list) * m_grow_available_indexes.size()) /
+        m_grow_hash_lists.extent(0));
+
+    size_type find_attempts = 0;
+
+    enum : unsigned { bounded_find_attempts = 32u };
+    const size_type max_attempts =
+        (m_bounded_insert &&
+         (bounded_find_attempts < m_grow_available_indexes.max_hint()))
+            ? bounded_find_attempts
+            : m_grow_available_indexes.max_hint();
+
+    for (;;) {
+      size_type curr = load(curr_ptr);
+
+      while (curr != invalid_index && !m_equal_to(grow_key_at(curr), k)) {
+        result.increment_list_position();
+        curr_ptr = &m_grow_next_index[curr];
+        curr     = load(curr_ptr);
+      }
+
+      if (curr != invalid_index) {
+        const bool free_existing = new_index != invalid_index;
+        if (free_existing) m_grow_available_indexes.reset(new_index);
+
+        result.set_existing(curr, free_existing);
+        if constexpr (!is_set) {
+          if (curr < primary_capacity) {
+            arg_insert_op.op(m_values, curr, v);
+          } else {
+            arg_insert_op.op(m_grow_values, curr - primary_capacity, v);
+          }
+        }
+        return result;
+      }
+
+      if (new_index == invalid_index) {
+        bool found = false;
+        Kokkos::tie(found, index_hint) =
+            m_grow_available_indexes.find_any_unset_near(index_hint,
+                                                         hash_list);
+
+        if (!found && ++find_attempts >= max_attempts) {
+          failed_insert_ref = true;
+          return result;
+        } else if (m_grow_available_indexes.set(index_hint)) {
+          new_index = index_hint;
+#ifdef KOKKOS_ENABLE_SYCL
+          Kokkos::atomic_store(&m_grow_keys[new_index], k);
+          if constexpr (!is_set) {
+            Kokkos::atomic_store(&m_grow_values[new_index], v);
+          }
+#else
+          m_grow_keys[new_index] = k;
+          if constexpr (!is_set) m_grow_values[new_index] = v;
+          // Do not proceed until key and value are updated in global memory
+          memory_fence();
+#endif
+        }
+      } else if (failed_insert_ref) {
+        m_grow_available_indexes.reset(new_index);
+        return result;
+      }
+
+      if (new_index != invalid_index &&
+          curr == atomic_compare_exchange(curr_ptr, curr,
+                                          primary_capacity + new_index)) {
+        result.set_success(primary_capacity + new_index);
+        return result;
+      }
+    }
+  }
+
  private:  // private members
   bool m_bounded_insert;
   hasher_type m_hasher;
@@ -955,6 +1350,13 @@ class UnorderedMap {
   key_type_view m_keys;
   value_type_view m_values;
   scalars_view m_scalars;
+  // Growth table, see reserve_growth()
+  bitset_type m_grow_available_indexes;
+  bitset_type m_grow_migrated;
+  size_type_view m_grow_hash_lists;
+  size_type_view m_grow_next_index;
+  key_type_view m_grow_keys;
+  value_type_view m_grow_values;
 
   template <typename KKey, typename VValue, typename DDevice, typename HHash,
             typename EEqualTo>
@@ -968,6 +1370,9 @@ class UnorderedMap {
 
   template <typename UMap>
   friend struct Impl::UnorderedMapPrint;
+
+  template <typename UMap, typename ExecSpace>
+  friend struct Impl::UnorderedMapBulk;
 };
 
 // Specialization of deep_copy() for two UnorderedMap objects.
@@ -40,6 +40,11 @@ static auto do_not_include = emit_warning_kokkos_vector_deprecated();
 #include <Kokkos_Core_fwd.hpp>
 #include <Kokkos_DualView.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
 /* Drop in replacement for std::vector based on Kokkos::DualView
  * Most functions only work on the host (it will not compile if called from
  * device kernel)
@@ -127,17 +132,20 @@ class KOKKOS_DEPRECATED vector
 
   void reserve(size_t n) { DV::resize(size_t(n * _extra_storage)); }
 
-  void push_back(Scalar val) {
-    DV::template sync<typename DV::t_host::device_type>();
-    DV::template modify<typename DV::t_host::device_type>();
-    if (_size == span()) {
-      size_t new_size = _size * _extra_storage;
-      if (new_size == _size) new_size++;
-      DV::resize(new_size);
-    }
+  void push_back(const Scalar& val) { emplace_back(val); }
+
+  void push_back(Scalar&& val) { emplace_back(std::move(val)); }
 
-    DV::h_view(_size) = val;
-    _size++;
+  template <class... Args>
+  reference emplace_back(Args&&... args) {
+    // Build the value before growing, args may refer to an element
+    Scalar val(std::forward<Args>(args)...);
+
+    impl_modify_host();
+    if (_size == span()) impl_grow_host(_size + 1);
+
+    DV::h_view(_size) = std::move(val);
+    return DV::h_view(_size++);
   }
 
   void pop_back() { _size--; }
@@ -200,6 +208,31 @@ class KOKKOS_DEPRECATED vector
     return begin() + start;
   }
 
+  /* Append the elements of [b, e) on the host, synchronizing and growing
+   * the storage at most once for forward iterators.  Single pass input
+   * iterators append element by element.  [b, e) may lie in this vector. */
+  template <typename InputIterator>
+  std::enable_if_t<impl_is_input_iterator<InputIterator>::value> append(
+      InputIterator b, InputIterator e) {
+    using category =
+        typename std::iterator_traits<InputIterator>::iterator_category;
+
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      const size_t count = std::distance(b, e);
+
+      impl_modify_host();
+
+      // Keep the old storage alive until it has been copied from
+      const typename DV::t_host old_host = DV::h_view;
+      impl_grow_host(_size + count);
+
+      std::copy(b, e, begin() + _size);
+      _size += count;
+    } else {
+      for (; b != e; ++b) emplace_back(*b);
+    }
+  }
+
   KOKKOS_INLINE_FUNCTION constexpr bool is_allocated() const {
     return DV::is_allocated();
   }
@@ -305,6 +338,34 @@ class KOKKOS_DEPRECATED vector
 
   void set_overallocation(float extra) { _extra_storage = 1.0 + extra; }
 
+ private:
+  /* Make the host copy current and mark it as modified.  Nothing is done if
+   * the host is already the last modified side, so that appending element
+   * by element does not go through the DualView for each element. */
+  void impl_modify_host() {
+    if (DV::modified_flags.data() == nullptr ||
+        DV::modified_flags(0) <= DV::modified_flags(1)) {
+      DV::template sync<typename DV::t_host::device_type>();
+      DV::template modify<typename DV::t_host::device_type>();
+    }
+  }
+
+  /* Grow the storage geometrically to hold at least n elements.  Must be
+   * called with the host marked as modified: the old contents are then only
+   * copied on the host, and the device view is reallocated without being
+   * initialized, to be filled by the next sync to the device. */
+  void impl_grow_host(size_t n) {
+    if (n <= span()) return;
+    size_t new_span = std::max(2 * span(), size_t(span() * _extra_storage));
+    if (new_span < n) new_span = n;
+
+    if constexpr (std::is_trivially_default_constructible_v<Scalar>) {
+      DV::resize(Kokkos::view_alloc(Kokkos::WithoutInitializing), new_span);
+    } else {
+      DV::resize(new_span);
+    }
+  }
+
  public:
   struct set_functor {
     using execution_space = typename DV::t_dev::execution_space;
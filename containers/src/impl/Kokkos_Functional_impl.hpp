@@ -20,6 +20,12 @@
 #include <Kokkos_Macros.hpp>
 #include <cstdint>
 
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
 namespace Kokkos {
 namespace Impl {
 
@@ -100,6 +106,196 @@ uint32_t MurmurHash3_x86_32(const void* key, int len, uint32_t seed) {
   return h1;
 }
 
+//----------------------------------------------------------------------------
+// 64-bit hashing.  Every function computes the same value on all backends
+// and, where templated on the word type, for simd<uint64_t> packs as for
+// uint64_t, so that host and device copies of a hash table agree.
+
+// Finalizer of SplitMix64, a bijection of the 64-bit integers
+template <typename U64>
+KOKKOS_FORCEINLINE_FUNCTION U64 mix64(U64 x) {
+  x = x ^ (x >> 30);
+  x = x * U64(0xbf58476d1ce4e5b9ull);
+  x = x ^ (x >> 27);
+  x = x * U64(0x94d049bb133111ebull);
+  return x ^ (x >> 31);
+}
+
+// Full 64x64 -> 128-bit product, from 32-bit halves
+template <typename U64>
+KOKKOS_FORCEINLINE_FUNCTION void mul128(U64& a, U64& b) {
+  const U64 mask(0xffffffffull);
+  const U64 a_lo = a & mask, a_hi = a >> 32;
+  const U64 b_lo = b & mask, b_hi = b >> 32;
+  const U64 ll = a_lo * b_lo, lh = a_lo * b_hi;
+  const U64 hl = a_hi * b_lo, hh = a_hi * b_hi;
+  const U64 mid = (ll >> 32) + (lh & mask) + (hl & mask);
+  a             = (ll & mask) | (mid << 32);
+  b             = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+}
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+KOKKOS_FORCEINLINE_FUNCTION void mul128(uint64_t& a, uint64_t& b) {
+#if defined(__SIZEOF_INT128__)
+  KOKKOS_IF_ON_HOST((const uint128_t r = uint128_t(a) * b; a = uint64_t(r);
+                     b = uint64_t(r >> 64); return;))
+#endif
+  mul128<uint64_t>(a, b);
+}
+
+// wyhash, version 4.2, by Wang Yi, released into the public domain
+enum : uint64_t {
+  wyhash_secret0 = 0x2d358dccaa6c78a5ull,
+  wyhash_secret1 = 0x8bb84b93962eacc9ull,
+  wyhash_secret2 = 0x4b33a62ed433d4a3ull,
+  wyhash_secret3 = 0x4d5a2da51de1aa47ull
+};
+
+template <typename U64>
+KOKKOS_FORCEINLINE_FUNCTION U64 wymix(U64 a, U64 b) {
+  mul128(a, b);
+  return a ^ b;
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+uint64_t wyr8(const uint8_t* p) {
+  return uint64_t(getblock32(p, 0)) | (uint64_t(getblock32(p, 1)) << 32);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+uint64_t wyr4(const uint8_t* p) { return getblock32(p, 0); }
+
+KOKKOS_FORCEINLINE_FUNCTION
+uint64_t wyr3(const uint8_t* p, int k) {
+  return (uint64_t(p[0]) << 16) | (uint64_t(p[k >> 1]) << 8) | p[k - 1];
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+uint64_t wyhash_seed(uint64_t seed) {
+  return seed ^
+         wymix(seed ^ uint64_t(wyhash_secret0), uint64_t(wyhash_secret1));
+}
+
+KOKKOS_INLINE_FUNCTION
+uint64_t wyhash(const void* key, int len, uint64_t seed) {
+  const uint8_t* p = static_cast<const uint8_t*>(key);
+
+  seed = wyhash_seed(seed);
+
+  uint64_t a, b;
+  if (len <= 16) {
+    if (len >= 4) {
+      const int s = (len >> 3) << 2;
+      a = (wyr4(p) << 32) | wyr4(p + s);
+      b = (wyr4(p + len - 4) << 32) | wyr4(p + len - 4 - s);
+    } else if (len > 0) {
+      a = wyr3(p, len);
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    int i = len;
+    if (i > 48) {
+      uint64_t see1 = seed, see2 = seed;
+      do {
+        seed = wymix(wyr8(p) ^ uint64_t(wyhash_secret1), wyr8(p + 8) ^ seed);
+        see1 = wymix(wyr8(p + 16) ^ uint64_t(wyhash_secret2),
+                     wyr8(p + 24) ^ see1);
+        see2 = wymix(wyr8(p + 32) ^ uint64_t(wyhash_secret3),
+                     wyr8(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16) {
+      seed = wymix(wyr8(p) ^ uint64_t(wyhash_secret1), wyr8(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = wyr8(p + i - 16);
+    b = wyr8(p + i - 8);
+  }
+  a ^= uint64_t(wyhash_secret1);
+  b ^= seed;
+  mul128(a, b);
+  return wymix(a ^ uint64_t(wyhash_secret0) ^ uint64_t(len),
+               b ^ uint64_t(wyhash_secret1));
+}
+
+// wyhash of the low 'len' <= 8 bytes of each word of 'x', which holds
+// keys zero or sign extended to 64 bits; 'seed' is from wyhash_seed().
+template <typename U64>
+KOKKOS_FORCEINLINE_FUNCTION U64 wyhash_word(U64 x, int len, uint64_t seed) {
+  const U64 mask(0xffffffffull);
+  U64 a, b;
+  if (len == 8) {
+    const U64 lo = x & mask, hi = x >> 32;
+    a            = (lo << 32) | hi;
+    b            = (hi << 32) | lo;
+  } else if (len >= 4) {
+    a = ((x & mask) << 32) | (x & mask);
+    b = a;
+  } else {
+    const U64 byte(0xffull);
+    const U64 first = x & byte, last = (x >> (8 * (len - 1))) & byte;
+    const U64 middle = (x >> (8 * (len >> 1))) & byte;
+    a                = (first << 16) | (middle << 8) | last;
+    b                = U64(0ull);
+  }
+  a = a ^ U64(uint64_t(wyhash_secret1));
+  b = b ^ U64(seed);
+  mul128(a, b);
+  return wymix(a ^ U64(uint64_t(wyhash_secret0) ^ uint64_t(len)),
+               b ^ U64(uint64_t(wyhash_secret1)));
+}
+
+// CRC-32C (Castagnoli), with the SSE4.2 or ARMv8 CRC32 instructions on
+// the host where available
+KOKKOS_FORCEINLINE_FUNCTION
+uint32_t crc32c_soft(uint32_t crc, uint64_t data, int bytes) {
+  for (int i = 0; i < bytes; ++i) {
+    crc ^= uint32_t(data >> (8 * i)) & 0xffu;
+    for (int k = 0; k < 8; ++k) {
+      crc = (crc >> 1) ^ (0x82f63b78u & (0u - (crc & 1u)));
+    }
+  }
+  return crc;
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+uint32_t crc32c_u64(uint32_t crc, uint64_t data) {
+#if defined(__SSE4_2__) && defined(__x86_64__)
+  KOKKOS_IF_ON_HOST((return uint32_t(_mm_crc32_u64(crc, data));))
+#elif defined(__ARM_FEATURE_CRC32) && defined(__aarch64__)
+  KOKKOS_IF_ON_HOST((return __crc32cd(crc, data);))
+#endif
+  return crc32c_soft(crc, data, 8);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+uint32_t crc32c_u8(uint32_t crc, uint8_t data) {
+#if defined(__SSE4_2__)
+  KOKKOS_IF_ON_HOST((return _mm_crc32_u8(crc, data);))
+#elif defined(__ARM_FEATURE_CRC32)
+  KOKKOS_IF_ON_HOST((return __crc32cb(crc, data);))
+#endif
+  return crc32c_soft(crc, data, 1);
+}
+
+KOKKOS_INLINE_FUNCTION
+uint32_t crc32c(const void* key, int len, uint32_t crc) {
+  const uint8_t* p = static_cast<const uint8_t*>(key);
+  crc              = ~crc;
+  for (; len >= 8; len -= 8, p += 8) crc = crc32c_u64(crc, wyr8(p));
+  for (; len > 0; --len, ++p) crc = crc32c_u8(crc, *p);
+  return ~crc;
+}
+
 #if defined(__GNUC__) /* GNU C   */ || defined(__GNUG__) /* GNU C++ */ || \
     defined(__clang__)
 
@@ -188,11 +188,12 @@ struct UnorderedMapHistogram {
 
   KOKKOS_INLINE_FUNCTION
   void operator()(size_type i) const {
-    const size_type invalid_index = map_type::invalid_index;
+    // Lists of a growing map end in sealed_index
+    const size_type sealed_index = map_type::sealed_index;
 
     uint32_t length     = 0;
     size_type min_index = ~0u, max_index = 0;
-    for (size_type curr = m_map.m_hash_lists(i); curr != invalid_index;
+    for (size_type curr = m_map.m_hash_lists(i); curr < sealed_index;
          curr           = m_map.m_next_index[curr]) {
       ++length;
       min_index = (curr < min_index) ? curr : min_index;
@@ -232,10 +233,11 @@ struct UnorderedMapPrint {
 
   KOKKOS_INLINE_FUNCTION
   void operator()(size_type i) const {
-    const size_type invalid_index = map_type::invalid_index;
+    // Lists of a growing map end in sealed_index
+    const size_type sealed_index = map_type::sealed_index;
 
     uint32_t list = m_map.m_hash_lists(i);
-    for (size_type curr = list, ii = 0; curr != invalid_index;
+    for (size_type curr = list, ii = 0; curr < sealed_index;
          curr = m_map.m_next_index[curr], ++ii) {
       Kokkos::printf("%d[%d]: %d->%d\n", list, ii, m_map.key_at(curr),
                      m_map.value_at(curr));
@@ -243,6 +245,169 @@ struct UnorderedMapPrint {
   }
 };
 
+/*  Bulk insert and find.  The batch is hashed once and partitioned by
+ *  ranges of hash lists with one pass of a counting sort, so that each
+ *  range of the table is worked on while it is in cache.  On the host the
+ *  hash list of an upcoming key is also prefetched.
+ */
+template <typename UMap, typename ExecSpace>
+struct UnorderedMapBulk {
+  using map_type     = UMap;
+  using size_type    = typename map_type::size_type;
+  using key_type     = typename map_type::key_type;
+  using memory_space = typename ExecSpace::memory_space;
+  using index_view   = View<size_type*, memory_space>;
+  using key_view     = View<key_type*, memory_space>;
+  using policy_type  = RangePolicy<ExecSpace, IndexType<size_type>>;
+
+  // Batches smaller than this are processed in their original order
+  enum : size_type { min_sort_size = 4096u };
+  // Hash lists per range, about 256 KiB of the table, and the minimum
+  // average number of keys per range.  The number of ranges is bounded so
+  // that the scatter of the sort writes to few enough pages at a time.
+  enum : size_type { lists_per_range = 16384u, min_keys_per_range = 64u };
+  enum : size_type { max_ranges = 256u };
+  // Work items between prefetching a hash list and searching it
+  enum : size_type { prefetch_distance = 8u };
+
+  // Batch sorted by hash list range: the i-th key processed is m_keys(i),
+  // which hashes to m_lists(i), from position m_order(i) of the batch.
+  // Unallocated if the batch is processed in its original order.
+  index_view m_order;
+  index_view m_lists;
+  key_view m_keys;
+
+  template <typename KeysView>
+  UnorderedMapBulk(ExecSpace const& exec, map_type const& map,
+                   KeysView const& keys) {
+    const size_type n         = keys.extent(0);
+    const size_type num_lists = map.m_hash_lists.extent(0);
+
+    if (n < min_sort_size || num_lists == 0u) return;
+
+    size_type num_ranges = (num_lists + lists_per_range - 1) / lists_per_range;
+    if (n / min_keys_per_range < num_ranges) {
+      num_ranges = n / min_keys_per_range;
+    }
+    if (max_ranges < num_ranges) num_ranges = max_ranges;
+    if (num_ranges < 2u) return;
+
+    m_order = index_view(
+        view_alloc(exec, WithoutInitializing, "UnorderedMap - bulk order"), n);
+    m_lists = index_view(
+        view_alloc(exec, WithoutInitializing, "UnorderedMap - bulk lists"), n);
+    m_keys = key_view(
+        view_alloc(exec, WithoutInitializing, "UnorderedMap - bulk keys"), n);
+
+    index_view unsorted_lists(
+        view_alloc(exec, WithoutInitializing, "UnorderedMap - bulk hash"), n);
+    index_view offsets(view_alloc(exec, "UnorderedMap - bulk offsets"),
+                       num_ranges + 1);
+
+    const index_view order = m_order;
+    const index_view lists = m_lists;
+    const key_view sorted  = m_keys;
+    const auto hasher      = map.m_hasher;
+
+    parallel_for(
+        "Kokkos::UnorderedMap::bulk_hash", policy_type(exec, 0, n),
+        KOKKOS_LAMBDA(size_type i) {
+          const size_type list =
+              static_cast<size_type>(hasher(keys(i))) % num_lists;
+          unsorted_lists(i)    = list;
+          atomic_increment(&offsets(
+              1 + static_cast<uint64_t>(list) * num_ranges / num_lists));
+        });
+
+    parallel_scan(
+        "Kokkos::UnorderedMap::bulk_offsets",
+        policy_type(exec, 0, num_ranges + 1),
+        KOKKOS_LAMBDA(size_type i, size_type & update, bool final) {
+          update += offsets(i);
+          if (final) offsets(i) = update;
+        });
+
+    parallel_for(
+        "Kokkos::UnorderedMap::bulk_sort", policy_type(exec, 0, n),
+        KOKKOS_LAMBDA(size_type i) {
+          const size_type list = unsorted_lists(i);
+          const size_type range =
+              static_cast<uint64_t>(list) * num_ranges / num_lists;
+          const size_type pos = atomic_fetch_add(&offsets(range), 1u);
+          order(pos)          = i;
+          lists(pos)          = list;
+          sorted(pos)         = keys(i);
+        });
+  }
+
+  template <typename KeysView, typename ValuesView, typename ResultsView,
+            typename InsertOpType>
+  void insert(ExecSpace const& exec, map_type const& map, KeysView const& keys,
+              ValuesView const& values, ResultsView const& results,
+              InsertOpType const& insert_op) const {
+    const size_type n = keys.extent(0);
+
+    if (!m_order.data()) {
+      parallel_for(
+          "Kokkos::UnorderedMap::insert_bulk", policy_type(exec, 0, n),
+          KOKKOS_LAMBDA(size_type i) {
+            if constexpr (map_type::is_set) {
+              results(i) = map.insert(keys(i));
+            } else {
+              results(i) = map.insert(keys(i), values(i), insert_op);
+            }
+          });
+      return;
+    }
+
+    const index_view order = m_order;
+    const index_view lists = m_lists;
+    const key_view sorted  = m_keys;
+
+    parallel_for(
+        "Kokkos::UnorderedMap::insert_bulk", policy_type(exec, 0, n),
+        KOKKOS_LAMBDA(size_type i) {
+          if (i + prefetch_distance < n) {
+            KOKKOS_NONTEMPORAL_PREFETCH_LOAD(
+                &map.m_hash_lists[lists(i + prefetch_distance)]);
+          }
+          const size_type j = order(i);
+          if constexpr (map_type::is_set) {
+            results(j) = map.insert(sorted(i));
+          } else {
+            results(j) = map.insert(sorted(i), values(j), insert_op);
+          }
+        });
+  }
+
+  template <typename KeysView, typename IndicesView>
+  void find(ExecSpace const& exec, map_type const& map, KeysView const& keys,
+            IndicesView const& indices) const {
+    const size_type n = keys.extent(0);
+
+    if (!m_order.data()) {
+      parallel_for(
+          "Kokkos::UnorderedMap::find_bulk", policy_type(exec, 0, n),
+          KOKKOS_LAMBDA(size_type i) { indices(i) = map.find(keys(i)); });
+      return;
+    }
+
+    const index_view order = m_order;
+    const index_view lists = m_lists;
+    const key_view sorted  = m_keys;
+
+    parallel_for(
+        "Kokkos::UnorderedMap::find_bulk", policy_type(exec, 0, n),
+        KOKKOS_LAMBDA(size_type i) {
+          if (i + prefetch_distance < n) {
+            KOKKOS_NONTEMPORAL_PREFETCH_LOAD(
+                &map.m_hash_lists[lists(i + prefetch_distance)]);
+          }
+          indices(order(i)) = map.find(sorted(i));
+        });
+  }
+};
+
 template <typename DKey, typename DValue, typename SKey, typename SValue>
 struct UnorderedMapCanAssign : public std::false_type {};
 
@@ -0,0 +1,99 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_COMBINING_ATOMIC_HPP
+#define KOKKOS_TEST_COMBINING_ATOMIC_HPP
+
+#include <Kokkos_CombiningAtomic.hpp>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace Test {
+
+template <typename ExecSpace>
+void test_combining_atomic_histogram(int num_bins, int cache_size) {
+  int const n = 100000;
+  Kokkos::View<int*, ExecSpace> counts("counts", num_bins);
+  Kokkos::Experimental::CombiningAtomic<Kokkos::View<int*, ExecSpace>> bins(
+      counts, cache_size);
+
+  // two kernels before the flush: cached values carry over between them
+  for (int pass = 0; pass < 2; ++pass) {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecSpace>(0, n), KOKKOS_LAMBDA(int i) {
+          auto access = bins.access();
+          access((i * 7 + i / 3) % num_bins) += 1;
+          if (i % 5 == 0) access(0)++;
+        });
+  }
+  bins.flush();
+
+  std::vector<int> expected(num_bins, 0);
+  for (int i = 0; i < n; ++i) {
+    expected[(i * 7 + i / 3) % num_bins] += 2;
+    if (i % 5 == 0) expected[0] += 2;
+  }
+  auto counts_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts);
+  for (int bin = 0; bin < num_bins; ++bin) {
+    ASSERT_EQ(counts_h(bin), expected[bin]) << "bin " << bin;
+  }
+
+  // the caches are empty after a flush
+  bins.flush();
+  Kokkos::deep_copy(counts_h, counts);
+  ASSERT_EQ(counts_h(0), expected[0]);
+}
+
+template <typename ExecSpace>
+void test_combining_atomic_max() {
+  int const n        = 10000;
+  int const num_bins = 100;
+  Kokkos::View<double*, ExecSpace> maxima("maxima", num_bins);
+  Kokkos::deep_copy(maxima, -1.0);
+  Kokkos::Experimental::CombiningAtomic<Kokkos::View<double*, ExecSpace>,
+                                        Kokkos::Experimental::ScatterMax>
+      bins(maxima, 16);
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace>(0, n), KOKKOS_LAMBDA(int i) {
+        bins.access()(i % num_bins).update(double(i));
+      });
+  bins.flush();
+
+  auto maxima_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), maxima);
+  for (int bin = 0; bin < num_bins; ++bin) {
+    ASSERT_EQ(maxima_h(bin), double(n - num_bins + bin)) << "bin " << bin;
+  }
+}
+
+TEST(TEST_CATEGORY, combining_atomic_histogram) {
+  // every bin fits in the caches
+  test_combining_atomic_histogram<TEST_EXECSPACE>(16, 64);
+  // bins are evicted from the caches
+  test_combining_atomic_histogram<TEST_EXECSPACE>(1000, 64);
+  test_combining_atomic_histogram<TEST_EXECSPACE>(37, 1);
+}
+
+TEST(TEST_CATEGORY, combining_atomic_max) {
+  test_combining_atomic_max<TEST_EXECSPACE>();
+}
+
+}  // namespace Test
+
+#endif  // KOKKOS_TEST_COMBINING_ATOMIC_HPP
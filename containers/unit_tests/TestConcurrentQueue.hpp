@@ -0,0 +1,153 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_CONCURRENT_QUEUE_HPP
+#define KOKKOS_TEST_CONCURRENT_QUEUE_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_ConcurrentQueue.hpp>
+
+#include <algorithm>
+
+namespace Test {
+
+// Check that the queue holds each of 0, ..., n - 1 once
+template <typename Queue>
+void check_queue_contents(Queue const &queue, uint32_t n) {
+  ASSERT_EQ(queue.size(), n);
+  auto items =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), queue.view());
+  ASSERT_EQ(items.extent(0), n);
+  std::sort(items.data(), items.data() + n);
+  for (uint32_t i = 0; i < n; ++i) ASSERT_EQ(items(i), i);
+}
+
+template <typename Device>
+void test_concurrent_queue(uint32_t n) {
+  using queue_type      = Kokkos::Experimental::ConcurrentQueue<int, Device>;
+  using execution_space = typename Device::execution_space;
+  using policy_type     = Kokkos::RangePolicy<execution_space>;
+  constexpr uint32_t chunk = 4;
+
+  queue_type queue(n);
+  ASSERT_EQ(queue.size(), 0u);
+
+  // Push in chunks, then pop everything
+  Kokkos::parallel_for(
+      policy_type(0, (n + chunk - 1) / chunk), KOKKOS_LAMBDA(uint32_t i) {
+        int values[chunk];
+        uint32_t count = 0;
+        for (uint32_t k = chunk * i; k < n && count < chunk; ++k) {
+          values[count++] = k;
+        }
+        queue.push_n(values, count);
+      });
+  ASSERT_FALSE(queue.failed_push());
+  check_queue_contents(queue, n);
+
+  long sum = 0;
+  Kokkos::parallel_reduce(
+      policy_type(0, n),
+      KOKKOS_LAMBDA(uint32_t, long &update) {
+        int values[3];
+        const uint32_t count = queue.pop_n(values, 3);
+        for (uint32_t k = 0; k < count; ++k) update += values[k];
+      },
+      sum);
+  ASSERT_EQ(sum, long(n) * (n - 1) / 2);
+  ASSERT_EQ(queue.size(), 0u);
+
+  // Pushes beyond the capacity fail
+  uint32_t pushed = 0;
+  Kokkos::parallel_reduce(
+      policy_type(0, 1),
+      KOKKOS_LAMBDA(uint32_t, uint32_t &update) {
+        int value = 0;
+        update += queue.push(value);
+      },
+      pushed);
+  ASSERT_EQ(pushed, 0u);
+  ASSERT_TRUE(queue.failed_push());
+
+  // Push and pop concurrently after a reset, every pop finds an item
+  queue.reset();
+  ASSERT_FALSE(queue.failed_push());
+  uint32_t errors = 0;
+  Kokkos::parallel_reduce(
+      policy_type(0, n),
+      KOKKOS_LAMBDA(uint32_t i, uint32_t &update) {
+        int value = -1;
+        if (!queue.push(i) || !queue.pop(value) || value < 0) ++update;
+      },
+      errors);
+  ASSERT_EQ(errors, 0u);
+  ASSERT_EQ(queue.size(), 0u);
+}
+
+template <typename Device>
+void test_concurrent_queue_team(uint32_t n) {
+  using queue_type      = Kokkos::Experimental::ConcurrentQueue<int, Device>;
+  using execution_space = typename Device::execution_space;
+  using policy_type     = Kokkos::TeamPolicy<execution_space>;
+  using member_type     = typename policy_type::member_type;
+
+  queue_type queue(n);
+
+  // Each thread pushes one key per round, all threads take part in every
+  // round
+  Kokkos::parallel_for(
+      policy_type(16, Kokkos::AUTO), KOKKOS_LAMBDA(member_type const &team) {
+        const uint32_t threads = team.league_size() * team.team_size();
+        const uint32_t thread =
+            team.league_rank() * team.team_size() + team.team_rank();
+        for (uint32_t round = 0; round * threads < n; ++round) {
+          const int k = round * threads + thread;
+          queue.push_n(team, &k, uint32_t(k) < n ? 1 : 0);
+        }
+      });
+  ASSERT_FALSE(queue.failed_push());
+  check_queue_contents(queue, n);
+
+  // Pop until the queue is empty
+  long sum = 0;
+  Kokkos::parallel_reduce(
+      policy_type(16, Kokkos::AUTO),
+      KOKKOS_LAMBDA(member_type const &team, long &update) {
+        for (;;) {
+          int values[3];
+          uint32_t count = queue.pop_n(team, values, 3);
+          for (uint32_t k = 0; k < count; ++k) update += values[k];
+          team.team_reduce(Kokkos::Sum<uint32_t>(count));
+          if (count == 0) break;
+        }
+      },
+      sum);
+  ASSERT_EQ(sum, long(n) * (n - 1) / 2);
+  ASSERT_EQ(queue.size(), 0u);
+}
+
+TEST(TEST_CATEGORY, ConcurrentQueue) {
+  test_concurrent_queue<TEST_EXECSPACE>(10000);
+  test_concurrent_queue<TEST_EXECSPACE>(1);
+}
+
+TEST(TEST_CATEGORY, ConcurrentQueue_team) {
+  test_concurrent_queue_team<TEST_EXECSPACE>(10000);
+}
+
+}  // namespace Test
+
+#endif  // KOKKOS_TEST_CONCURRENT_QUEUE_HPP
@@ -503,6 +503,86 @@ TEST(TEST_CATEGORY, dualview_resize) {
                              /* Initialize */ false>();
 }
 
+template <typename Device>
+void test_dualview_modify_range() {
+  using dv_type = Kokkos::DualView<int**, Kokkos::LayoutRight, Device>;
+  using exec    = typename dv_type::t_dev::execution_space;
+  const size_t n    = 100000;
+  const size_t rows = dv_type::dirty_block_bytes / (3 * sizeof(int));
+
+  // Separate allocations, so that the copies made by sync are visible
+  dv_type dv(typename dv_type::t_dev("d", n, 3),
+             typename dv_type::t_host("h", n, 3));
+  if (dv_type::impl_dualview_is_single_device::value) return;
+  ASSERT_FALSE(dv.need_sync_device());
+  const dv_type copy = dv;
+
+  // Only the blocks holding the modified rows are copied
+  Kokkos::deep_copy(dv.h_view, 1);
+  dv.modify_host(10, 20);
+  dv.modify_host(n - 5, n);
+  ASSERT_TRUE(dv.need_sync_device());
+  ASSERT_TRUE(copy.need_sync_device());
+  ASSERT_FALSE(dv.need_sync_host());
+  dv.sync_device();
+  ASSERT_FALSE(dv.need_sync_device());
+
+  auto check = [&](auto const& view, size_t i) {
+    auto host =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), view);
+    return host(i, 0) + host(i, 1) + host(i, 2);
+  };
+  ASSERT_EQ(check(dv.d_view, 15), 3);
+  ASSERT_EQ(check(dv.d_view, rows - 1), 3);
+  ASSERT_EQ(check(dv.d_view, rows), 0);
+  ASSERT_EQ(check(dv.d_view, n - 1), 3);
+  ASSERT_EQ(check(dv.d_view, n - 1 - rows), 0);
+
+  // Adjacent and separate ranges modified on the device
+  auto d_view = dv.d_view;
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<exec>(0, n),
+      KOKKOS_LAMBDA(int i) { d_view(i, 1) = 2; });
+  dv.template modify<typename dv_type::t_dev::device_type>(rows, 2 * rows);
+  dv.modify_device(2 * rows, 2 * rows + 1);
+  dv.modify_device(n / 2, n / 2 + 1);
+  ASSERT_TRUE(dv.need_sync_host());
+  dv.template sync<typename dv_type::t_host::device_type>();
+  ASSERT_FALSE(dv.need_sync_host());
+  ASSERT_EQ(check(dv.h_view, 0), 3);
+  ASSERT_EQ(check(dv.h_view, rows), 2);
+  ASSERT_EQ(check(dv.h_view, 3 * rows - 1), 2);
+  ASSERT_EQ(check(dv.h_view, 3 * rows), 3);
+  ASSERT_EQ(check(dv.h_view, n / 2), 2);
+
+  // Modifying the whole View supersedes the ranges
+  dv.modify_host(0, 1);
+  dv.modify_host();
+  dv.sync_device(exec());
+  exec().fence();
+  ASSERT_EQ(check(dv.d_view, n / 2), check(dv.h_view, n / 2));
+  ASSERT_EQ(check(dv.d_view, 3 * rows), 3);
+  ASSERT_FALSE(dv.need_sync_device());
+
+  // A subview copies its whole extent when ranges of its parent are marked
+  auto sub = Kokkos::subview(dv, std::make_pair(size_t(0), rows), Kokkos::ALL);
+  Kokkos::deep_copy(dv.h_view, 4);
+  dv.modify_host(n - 1, n);
+  ASSERT_TRUE(sub.need_sync_device());
+  sub.sync_device();
+  ASSERT_EQ(check(dv.d_view, 0), 12);
+  ASSERT_EQ(check(dv.d_view, n - 1), 3);
+  ASSERT_TRUE(dv.need_sync_device());
+  dv.sync_device();
+  ASSERT_FALSE(dv.need_sync_device());
+  ASSERT_EQ(check(dv.d_view, n - 1), 12);
+  ASSERT_EQ(check(dv.d_view, 3 * rows), 3);
+}
+
+TEST(TEST_CATEGORY, dualview_modify_range) {
+  test_dualview_modify_range<TEST_EXECSPACE>();
+}
+
 namespace {
 /**
  *
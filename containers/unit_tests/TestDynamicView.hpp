@@ -21,6 +21,7 @@
 #include <iostream>
 #include <cstdlib>
 #include <cstdio>
+#include <vector>
 #include <Kokkos_Core.hpp>
 
 #include <Kokkos_DynamicView.hpp>
@@ -255,6 +256,51 @@ struct TestDynamicView {
   }
 };
 
+template <class Space>
+void test_dynamic_view_grow_by(unsigned n) {
+  using view_type = Kokkos::Experimental::DynamicView<unsigned*, Space>;
+
+  view_type da("da", 64, 4 * n);
+  da.resize_serial(10);
+  for (unsigned i = 0; i < 10; ++i) da(i) = 0;
+
+  // Entry i appends i % 4 copies of i
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<Space>(0, n), [=](const unsigned i) {
+        const size_t begin = da.grow_by(i % 4);
+        for (unsigned k = 0; k < i % 4; ++k) da(begin + k) = i;
+      });
+
+  size_t expected_size = 10;
+  for (unsigned i = 0; i < n; ++i) expected_size += i % 4;
+  ASSERT_EQ(da.size(), expected_size);
+  ASSERT_GE(da.allocation_extent(), expected_size);
+  ASSERT_LT(da.allocation_extent(), expected_size + da.chunk_size());
+
+  std::vector<unsigned> count(n, 0);
+  for (size_t j = 10; j < expected_size; ++j) ++count[da(j)];
+  for (unsigned i = 0; i < n; ++i) ASSERT_EQ(count[i], i % 4);
+
+  // Append after shrinking
+  da.resize_serial(5);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<Space>(0, n),
+      [=](const unsigned i) { da.append(i); });
+  ASSERT_EQ(da.size(), size_t(n) + 5);
+}
+
+TEST(TEST_CATEGORY, dynamic_view_grow_by) {
+  // grow_by is only callable on the host, and with the chunk pointers
+  // shared between host and device
+  using memory_space = TEST_EXECSPACE::memory_space;
+  using space_type   = std::conditional_t<
+      Kokkos::SpaceAccessibility<Kokkos::HostSpace, memory_space>::accessible &&
+          Kokkos::Impl::MemorySpaceAccess<memory_space,
+                                          Kokkos::HostSpace>::accessible,
+      TEST_EXECSPACE, Kokkos::DefaultHostExecutionSpace>;
+  test_dynamic_view_grow_by<space_type>(10000);
+}
+
 TEST(TEST_CATEGORY, dynamic_view) {
   using TestDynView = TestDynamicView<double, TEST_EXECSPACE>;
 
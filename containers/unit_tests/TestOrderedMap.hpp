@@ -0,0 +1,163 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_ORDERED_MAP_HPP
+#define KOKKOS_TEST_ORDERED_MAP_HPP
+
+#include <gtest/gtest.h>
+#include <Kokkos_OrderedMap.hpp>
+
+namespace Test {
+
+// Walk the map in key order, counting entries out of order
+template <typename Map>
+uint32_t count_order_errors(Map const &map, uint32_t expected_size) {
+  using execution_space = typename Map::execution_space;
+  uint32_t errors       = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(0, 1),
+      KOKKOS_LAMBDA(int, uint32_t &update) {
+        uint32_t count = 0;
+        uint32_t prev  = 0;
+        for (uint32_t i = map.first(); map.valid_at(i); i = map.next(i)) {
+          if (count > 0 && !(map.key_at(prev) < map.key_at(i))) ++update;
+          prev = i;
+          ++count;
+        }
+        if (count != expected_size) ++update;
+      },
+      errors);
+  return errors;
+}
+
+template <typename Device>
+void test_ordered_map_insert(uint32_t num_keys) {
+  using map_type        = Kokkos::Experimental::OrderedMap<int, int, Device>;
+  using execution_space = typename Device::execution_space;
+  using policy_type     = Kokkos::RangePolicy<execution_space>;
+
+  map_type map(num_keys);
+  ASSERT_EQ(map.size(), 0u);
+
+  // Every even key below 2 * num_keys twice, in scrambled order
+  Kokkos::parallel_for(
+      policy_type(0, 2 * num_keys), KOKKOS_LAMBDA(uint32_t i) {
+        const int k = 2 * int((uint64_t(i) * 7919) % num_keys);
+        map.insert(k, k + 1);
+      });
+  ASSERT_EQ(map.size(), num_keys);
+  ASSERT_FALSE(map.failed_insert());
+  ASSERT_EQ(count_order_errors(map, num_keys), 0u);
+
+  uint32_t errors = 0;
+  Kokkos::parallel_reduce(
+      policy_type(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t j, uint32_t &update) {
+        const int k       = 2 * int(j);
+        const uint32_t at = map.find(k);
+        if (!map.valid_at(at) || map.key_at(at) != k ||
+            map.value_at(at) != k + 1)
+          ++update;
+        if (map.exists(k + 1)) ++update;
+
+        const uint32_t lower = map.lower_bound(k + 1);
+        const uint32_t upper = map.upper_bound(k);
+        if (j + 1 < num_keys) {
+          if (!map.valid_at(lower) || map.key_at(lower) != k + 2) ++update;
+          if (upper != lower) ++update;
+        } else if (map.valid_at(lower) || map.valid_at(upper)) {
+          ++update;
+        }
+        if (map.lower_bound(k) != at) ++update;
+      },
+      errors);
+  ASSERT_EQ(errors, 0u);
+
+  // Inserting into a full map fails, existing keys are still found
+  Kokkos::parallel_reduce(
+      policy_type(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t j, uint32_t &update) {
+        if (!map.insert(2 * int(j) + 1).failed()) ++update;
+        if (!map.insert(2 * int(j)).existing()) ++update;
+      },
+      errors);
+  ASSERT_EQ(errors, 0u);
+  ASSERT_TRUE(map.failed_insert());
+  ASSERT_EQ(map.size(), num_keys);
+
+  map.clear();
+  ASSERT_EQ(map.size(), 0u);
+  ASSERT_FALSE(map.failed_insert());
+  ASSERT_EQ(count_order_errors(map, 0), 0u);
+}
+
+template <typename Device>
+void test_ordered_map_build_from_sorted(uint32_t num_keys) {
+  using set_type        = Kokkos::Experimental::OrderedMap<int, void, Device>;
+  using execution_space = typename Device::execution_space;
+  using policy_type     = Kokkos::RangePolicy<execution_space>;
+
+  Kokkos::View<int *, Device> keys("keys", num_keys);
+  Kokkos::parallel_for(
+      policy_type(0, num_keys), KOKKOS_LAMBDA(uint32_t i) { keys(i) = 3 * i; });
+
+  set_type set(2 * num_keys);
+  set.build_from_sorted(keys);
+  ASSERT_EQ(set.size(), num_keys);
+  ASSERT_EQ(count_order_errors(set, num_keys), 0u);
+
+  // Insert between the keys of the bulk build
+  Kokkos::parallel_for(
+      policy_type(0, num_keys), KOKKOS_LAMBDA(uint32_t i) {
+        set.insert(3 * int(num_keys - 1 - i) + 1);
+      });
+  ASSERT_EQ(set.size(), 2 * num_keys);
+  ASSERT_FALSE(set.failed_insert());
+  ASSERT_EQ(count_order_errors(set, 2 * num_keys), 0u);
+
+  uint32_t errors = 0;
+  Kokkos::parallel_reduce(
+      policy_type(0, num_keys),
+      KOKKOS_LAMBDA(uint32_t i, uint32_t &update) {
+        const int k = 3 * int(i);
+        if (!set.exists(k) || !set.exists(k + 1) || set.exists(k + 2))
+          ++update;
+        const uint32_t upper = set.upper_bound(k + 1);
+        if (i + 1 < num_keys && set.key_at(upper) != k + 3) ++update;
+      },
+      errors);
+  ASSERT_EQ(errors, 0u);
+
+  // Unsorted keys are rejected
+  if (num_keys > 1) {
+    Kokkos::deep_copy(Kokkos::subview(keys, 0), 3);
+    ASSERT_THROW(set.build_from_sorted(keys), std::runtime_error);
+  }
+}
+
+TEST(TEST_CATEGORY, OrderedMap_insert) {
+  test_ordered_map_insert<TEST_EXECSPACE>(10000);
+  test_ordered_map_insert<TEST_EXECSPACE>(1);
+}
+
+TEST(TEST_CATEGORY, OrderedMap_build_from_sorted) {
+  test_ordered_map_build_from_sorted<TEST_EXECSPACE>(100000);
+  test_ordered_map_build_from_sorted<TEST_EXECSPACE>(1);
+}
+
+}  // namespace Test
+
+#endif  // KOKKOS_TEST_ORDERED_MAP_HPP
@@ -18,8 +18,10 @@
 #define KOKKOS_TEST_UNORDERED_MAP_HPP
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <iostream>
 #include <Kokkos_UnorderedMap.hpp>
+#include <Kokkos_SIMD.hpp>
 
 namespace Test {
 
@@ -343,6 +345,184 @@ void test_failed_insert(uint32_t num_nodes) {
   EXPECT_TRUE(map.failed_insert());
 }
 
+template <typename MapType>
+uint32_t count_growable_errors(MapType const &map, uint32_t num_keys) {
+  uint32_t errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<typename MapType::execution_space>(0, 2 * num_keys),
+      KOKKOS_LAMBDA(uint32_t key, uint32_t &update) {
+        const uint32_t index = map.find(key);
+        if (key < num_keys) {
+          if (!map.valid_at(index) || map.value_at(index) != 2 * (key + 1))
+            ++update;
+        } else if (map.exists(key)) {
+          ++update;
+        }
+      },
+      errors);
+  return errors;
+}
+
+template <typename Device>
+void test_growable_insert(uint32_t num_nodes) {
+  using map_type = Kokkos::UnorderedMap<uint32_t, uint32_t, Device>;
+  using atomic_add_type = typename Kokkos::UnorderedMapInsertOpTypes<
+      Kokkos::View<uint32_t *, Device>, uint32_t>::AtomicAdd;
+
+  // Each key is inserted twice with its value accumulated, in a map that
+  // must grow to hold them.
+  map_type map(num_nodes / 2);
+  map.reserve_growth(2 * num_nodes);
+  const uint32_t num_keys = num_nodes;
+
+  uint32_t failed = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<typename Device::execution_space>(0, 2 * num_keys),
+      KOKKOS_LAMBDA(uint32_t i, uint32_t &update) {
+        const uint32_t key = i % num_keys;
+        auto result        = map.insert(key, key + 1, atomic_add_type());
+        if (result.failed() || map.key_at(result.index()) != key) ++update;
+      },
+      failed);
+
+  ASSERT_EQ(failed, 0u);
+  ASSERT_FALSE(map.failed_insert());
+  ASSERT_TRUE(map.growing());
+  ASSERT_EQ(map.size(), num_keys);
+
+  ASSERT_EQ(count_growable_errors(map, num_keys), 0u);
+
+  // Rehashing folds both tables into one that can grow again
+  map.rehash(map.capacity());
+  ASSERT_FALSE(map.growing());
+  ASSERT_EQ(map.size(), num_keys);
+  ASSERT_EQ(count_growable_errors(map, num_keys), 0u);
+}
+
+template <typename Device>
+void test_bulk(uint32_t num_keys) {
+  using map_type = Kokkos::UnorderedMap<uint32_t, uint32_t, Device>;
+  using set_type = Kokkos::UnorderedMap<uint32_t, void, Device>;
+  using atomic_add_type = typename Kokkos::UnorderedMapInsertOpTypes<
+      Kokkos::View<uint32_t *, Device>, uint32_t>::AtomicAdd;
+  using execution_space = typename Device::execution_space;
+
+  // Every key twice, and as many absent keys to find
+  const uint32_t n = 2 * num_keys;
+  Kokkos::View<uint32_t *, Device> keys("keys", n), values("values", n);
+  Kokkos::View<Kokkos::UnorderedMapInsertResult *, Device> results("results",
+                                                                  n);
+  Kokkos::View<uint32_t *, Device> indices("indices", n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, n),
+      KOKKOS_LAMBDA(uint32_t i) {
+        keys(i)   = 7 * (i % num_keys);
+        values(i) = i % num_keys + 1;
+      });
+
+  map_type map(num_keys);
+  map.insert_bulk(execution_space(), keys, values, results, atomic_add_type());
+  set_type set(num_keys);
+  Kokkos::View<Kokkos::UnorderedMapInsertResult *, Device> set_results(
+      "set_results", n);
+  set.insert_bulk(execution_space(), keys, set_results);
+  ASSERT_EQ(map.size(), num_keys);
+  ASSERT_EQ(set.size(), num_keys);
+
+  uint32_t errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(0, n),
+      KOKKOS_LAMBDA(uint32_t i, uint32_t &update) {
+        if (results(i).failed() || set_results(i).failed() ||
+            map.key_at(results(i).index()) != keys(i) ||
+            set.key_at(set_results(i).index()) != keys(i))
+          ++update;
+      },
+      errors);
+  ASSERT_EQ(errors, 0u);
+
+  // Probe for present and absent keys
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, n),
+      KOKKOS_LAMBDA(uint32_t i) { keys(i) = 7 * i; });
+  map.find_bulk(execution_space(), keys, indices);
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<execution_space>(0, n),
+      KOKKOS_LAMBDA(uint32_t i, uint32_t &update) {
+        const uint32_t index = indices(i);
+        if (i < num_keys) {
+          if (!map.valid_at(index) || map.key_at(index) != keys(i) ||
+              map.value_at(index) != 2 * (i + 1))
+            ++update;
+        } else if (map.valid_at(index)) {
+          ++update;
+        }
+      },
+      errors);
+  ASSERT_EQ(errors, 0u);
+}
+
+// Hashes computed on the device, the host and of simd packs must agree
+template <typename Device, typename Key, typename Hasher>
+void test_hasher() {
+  using execution_space = typename Device::execution_space;
+  using simd_type       = Kokkos::Experimental::native_simd<uint64_t>;
+  using key_simd_type =
+      Kokkos::Experimental::simd<Key, typename simd_type::abi_type>;
+
+  const int n = 1000;
+  Kokkos::View<uint64_t *, Device> hashes("hashes", n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, n), KOKKOS_LAMBDA(int i) {
+        hashes(i) = Hasher()(static_cast<Key>(i - n / 2));
+      });
+  auto h_hashes =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), hashes);
+
+  const Hasher hasher;
+  const int width = simd_type::size();
+  for (int i = 0; i + width <= n; i += width) {
+    const key_simd_type keys(
+        [&](std::size_t j) { return static_cast<Key>(i + int(j) - n / 2); });
+    const simd_type packed = hasher.hash_n(keys);
+    for (int j = 0; j < width; ++j) {
+      ASSERT_EQ(hasher(static_cast<Key>(i + j - n / 2)), h_hashes(i + j));
+      ASSERT_EQ(packed[j], h_hashes(i + j));
+    }
+  }
+
+  std::sort(h_hashes.data(), h_hashes.data() + n);
+  ASSERT_EQ(std::unique(h_hashes.data(), h_hashes.data() + n),
+            h_hashes.data() + n);
+}
+
+template <typename Device>
+void test_hashers() {
+  using namespace Kokkos::Experimental;
+  test_hasher<Device, int32_t, mix_hash<int32_t>>();
+  test_hasher<Device, int64_t, mix_hash<int64_t>>();
+  test_hasher<Device, uint64_t, mix_hash<uint64_t>>();
+  test_hasher<Device, int32_t, wy_hash<int32_t>>();
+  test_hasher<Device, uint64_t, wy_hash<uint64_t>>();
+  test_hasher<Device, int32_t, crc32_hash<int32_t>>();
+  test_hasher<Device, uint64_t, crc32_hash<uint64_t>>();
+
+  // Check value of CRC-32C
+  struct digits {
+    char c[9];
+  };
+  ASSERT_EQ(crc32_hash<digits>()(digits{{'1', '2', '3', '4', '5', '6', '7',
+                                         '8', '9'}}),
+            0xe3069283u);
+
+  // Keys longer than one block of wyhash
+  struct long_key {
+    uint64_t k[7];
+  };
+  ASSERT_NE(wy_hash<long_key>()(long_key{{1, 2, 3, 4, 5, 6, 7}}),
+            wy_hash<long_key>()(long_key{{1, 2, 3, 4, 5, 6, 8}}));
+}
+
 template <typename Device>
 void test_deep_copy(uint32_t num_nodes) {
   using map_type = Kokkos::UnorderedMap<uint32_t, uint32_t, Device>;
@@ -412,6 +592,18 @@ TEST(TEST_CATEGORY, UnorderedMap_failed_insert) {
   for (int i = 0; i < 1000; ++i) test_failed_insert<TEST_EXECSPACE>(10000);
 }
 
+TEST(TEST_CATEGORY, UnorderedMap_growable_insert) {
+  for (int i = 0; i < 10; ++i) test_growable_insert<TEST_EXECSPACE>(10000);
+}
+
+TEST(TEST_CATEGORY, UnorderedMap_bulk) {
+  // Large enough to be sorted by hash list range, and a small batch
+  test_bulk<TEST_EXECSPACE>(100000);
+  test_bulk<TEST_EXECSPACE>(1000);
+}
+
+TEST(TEST_CATEGORY, UnorderedMap_hashers) { test_hashers<TEST_EXECSPACE>(); }
+
 TEST(TEST_CATEGORY, UnorderedMap_deep_copy) {
   for (int i = 0; i < 2; ++i) test_deep_copy<TEST_EXECSPACE>(10000);
 }
@@ -19,8 +19,11 @@
 
 #include <gtest/gtest.h>
 #include <iostream>
+#include <iterator>
+#include <sstream>
 #include <cstdlib>
 #include <cstdio>
+#include <vector>
 #include <Kokkos_Macros.hpp>
 KOKKOS_IMPL_DISABLE_DEPRECATED_WARNINGS_PUSH()
 #include <Kokkos_Vector.hpp>
@@ -253,6 +256,85 @@ TEST(TEST_CATEGORY, vector_push_back_default_exec) {
   ASSERT_EQ(V[0], 4);
 }
 
+TEST(TEST_CATEGORY, vector_append) {
+  Kokkos::vector<int, TEST_EXECSPACE> V;
+  std::vector<int> reference;
+  for (int i = 0; i < 1000; ++i) {
+    V.push_back(i);
+    reference.push_back(i);
+  }
+  // Growth is geometric
+  ASSERT_LE(V.span(), 2 * V.size());
+
+  V.append(reference.begin(), reference.end());
+  ASSERT_EQ(V.size(), 2 * reference.size());
+  for (size_t i = 0; i < V.size(); ++i) {
+    ASSERT_EQ(V[i], reference[i % reference.size()]);
+  }
+
+  // The device copy is brought up to date by the next sync
+  V.sync_device();
+  auto d_view = V.template view<typename TEST_EXECSPACE::memory_space>();
+  int errors  = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, V.size()),
+      KOKKOS_LAMBDA(int i, int& update) {
+        if (d_view(i) != i % 1000) ++update;
+      },
+      errors);
+  ASSERT_EQ(errors, 0);
+
+  // Appending after a modification on the device syncs the host first
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, V.size()),
+      KOKKOS_LAMBDA(int i) { d_view(i) = -i; });
+  V.modify_device();
+  V.push_back(7);
+  ASSERT_EQ(V[1], -1);
+  ASSERT_EQ(V.back(), 7);
+}
+
+TEST(TEST_CATEGORY, vector_append_aliasing) {
+  Kokkos::vector<int, TEST_EXECSPACE> V;
+  V.push_back(3);
+  // Growing the storage must not invalidate the value being added
+  for (int i = 0; i < 100; ++i) {
+    V.push_back(V[0]);
+    V.emplace_back(V.back());
+  }
+  ASSERT_EQ(V.size(), 201u);
+  for (size_t i = 0; i < V.size(); ++i) ASSERT_EQ(V[i], 3);
+
+  for (size_t i = 0; i < V.size(); ++i) V[i] = i;
+  V.append(V.begin(), V.end());
+  ASSERT_EQ(V.size(), 402u);
+  for (size_t i = 0; i < V.size(); ++i) ASSERT_EQ(V[i], int(i % 201));
+
+  // Single pass input iterators
+  std::istringstream input("5 6 7");
+  V.append(std::istream_iterator<int>(input), std::istream_iterator<int>());
+  ASSERT_EQ(V.size(), 405u);
+  ASSERT_EQ(V[402], 5);
+  ASSERT_EQ(V[404], 7);
+}
+
+TEST(TEST_CATEGORY, vector_emplace_back) {
+  using pair_type = Kokkos::pair<int, double>;
+  Kokkos::vector<pair_type, TEST_EXECSPACE> V;
+  for (int i = 0; i < 100; ++i) {
+    pair_type& p = V.emplace_back(i, 0.5 * i);
+    ASSERT_EQ(p.first, i);
+  }
+  pair_type p(-1, -1.);
+  V.push_back(std::move(p));
+  ASSERT_EQ(V.size(), 101u);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(V[i].first, i);
+    ASSERT_EQ(V[i].second, 0.5 * i);
+  }
+  ASSERT_EQ(V.back().first, -1);
+}
+
 }  // namespace Test
 
 #endif  // KOKKOS_TEST_UNORDERED_MAP_HPP
@@ -27,6 +27,7 @@ static_assert(false,
 #include <KokkosExp_MDRangePolicy.hpp>
 #include <Kokkos_Layout.hpp>
 #include <impl/Kokkos_HostSpace_ZeroMemset.hpp>
+#include <impl/Kokkos_ViewCopyTranspose.hpp>
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
@@ -557,6 +558,9 @@ void view_copy(const ExecutionSpace& space, const DstType& dst,
     Kokkos::Impl::throw_runtime_exception(
         "Kokkos::Impl::view_copy called with invalid execution space");
   } else {
+    // Host layout conversions transpose tiles instead
+    if (view_copy_transpose(space, dst, src)) return;
+
     // Figure out iteration order in case we need it
     int64_t strides[DstType::rank + 1];
     dst.stride(strides);
@@ -644,6 +648,13 @@ void view_copy(const DstType& dst, const SrcType& src) {
     Kokkos::Impl::throw_runtime_exception(ss.str());
   }
 
+  // Host layout conversions transpose tiles instead
+  if (DstExecCanAccessSrc) {
+    if (view_copy_transpose(dst_execution_space(), dst, src)) return;
+  } else {
+    if (view_copy_transpose(src_execution_space(), dst, src)) return;
+  }
+
   // Figure out iteration order in case we need it
   int64_t strides[DstType::rank + 1];
   dst.stride(strides);
@@ -1365,6 +1376,17 @@ inline std::enable_if_t<
 contiguous_fill_or_memset(
     const ExecutionSpace& exec_space, const View<DT, DP...>& dst,
     typename ViewTraits<DT, DP...>::const_value_type& value) {
+  using value_type = typename ViewTraits<DT, DP...>::value_type;
+
+  // Fills larger than the last level cache use streaming stores
+  if constexpr (Kokkos::SpaceAccessibility<ExecutionSpace,
+                                           Kokkos::HostSpace>::accessible) {
+    if (hostspace_parallel_fill_async(exec_space, dst.data(), &value,
+                                      sizeof(value_type),
+                                      dst.size() * sizeof(value_type)))
+      return;
+  }
+
   // With OpenMP, using memset has significant performance issues.
   if (Impl::is_zero_byte(value)
 #ifdef KOKKOS_ENABLE_OPENMP
@@ -1401,6 +1423,15 @@ contiguous_fill_or_memset(
   using exec_space_type = typename ViewType::execution_space;
   exec_space_type exec;
 
+  // Fills larger than the last level cache use streaming stores
+  if constexpr (Kokkos::SpaceAccessibility<exec_space_type,
+                                           Kokkos::HostSpace>::accessible) {
+    if (hostspace_parallel_fill_async(
+            exec, dst.data(), &value, sizeof(typename ViewType::value_type),
+            dst.size() * sizeof(typename ViewType::value_type)))
+      return;
+  }
+
 // On A64FX memset seems to do the wrong thing with regards to first touch
 // leading to the significant performance issues
 #ifndef KOKKOS_ARCH_A64FX
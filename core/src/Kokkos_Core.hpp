@@ -46,6 +46,7 @@
 
 #include <Kokkos_Half.hpp>
 #include <Kokkos_AnonymousSpace.hpp>
+#include <Kokkos_MappedFileSpace.hpp>
 #include <Kokkos_Pair.hpp>
 #include <Kokkos_Clamp.hpp>
 #include <Kokkos_MinMax.hpp>
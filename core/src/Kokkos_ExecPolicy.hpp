@@ -26,7 +26,9 @@ static_assert(false,
 #include <impl/Kokkos_Traits.hpp>
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_AnalyzePolicy.hpp>
+#include <impl/Kokkos_SharedAlloc.hpp>
 #include <Kokkos_Concepts.hpp>
+#include <Kokkos_DetectionIdiom.hpp>
 #include <Kokkos_TypeInfo.hpp>
 #ifndef KOKKOS_ENABLE_IMPL_TYPEINFO
 #include <typeinfo>
@@ -585,6 +587,74 @@ struct ScratchRequest {
 // Causes abnormal program termination if level is not `0` or `1`
 void team_policy_check_valid_storage_level_argument(int level);
 
+namespace Experimental {
+
+/** \brief  Prefix sums of the work carried by the league ranks of a
+ *  TeamPolicy.
+ *
+ *  Built from a rank-1 View of integers `offsets` holding league_size + 1
+ *  nondecreasing entries, league rank `i` carrying
+ *  `offsets(i + 1) - offsets(i)` units of work, as the row map of a
+ *  StaticCrsGraph does for its rows.  Backends that support it hand every
+ *  team a contiguous range of league ranks carrying about the same work;
+ *  the others ignore it.  The View must be accessible from the host.
+ */
+class WorkOffsets {
+ public:
+  WorkOffsets() = default;
+
+  template <class ViewType>
+  explicit WorkOffsets(const ViewType& offsets)
+      : m_track(offsets.impl_track()),
+        m_data(offsets.data()),
+        m_size(offsets.extent(0)),
+        m_stride(offsets.stride(0)),
+        m_load(&load<typename ViewType::const_value_type>) {
+    static_assert(ViewType::rank == 1 &&
+                      std::is_integral_v<typename ViewType::value_type>,
+                  "Kokkos::Experimental::WorkOffsets: offsets must be a "
+                  "rank-1 View of integers");
+    static_assert(
+        SpaceAccessibility<HostSpace,
+                           typename ViewType::memory_space>::accessible,
+        "Kokkos::Experimental::WorkOffsets: offsets must be accessible from "
+        "the host");
+  }
+
+  //! Number of offsets, one more than the league size; 0 if unset.
+  size_t size() const { return m_size; }
+
+  int64_t operator()(size_t i) const { return m_load(m_data, i * m_stride); }
+
+ private:
+  template <class T>
+  static int64_t load(const void* data, size_t i) {
+    return static_cast<int64_t>(static_cast<T*>(data)[i]);
+  }
+
+  Impl::SharedAllocationTracker m_track;
+  const void* m_data                     = nullptr;
+  size_t m_size                          = 0;
+  size_t m_stride                        = 0;
+  int64_t (*m_load)(const void*, size_t) = nullptr;
+};
+
+}  // namespace Experimental
+
+namespace Impl {
+
+template <class Policy>
+using team_policy_set_work_offsets_t =
+    decltype(std::declval<Policy&>().impl_set_work_offsets(
+        std::declval<const Kokkos::Experimental::WorkOffsets&>()));
+
+// Causes abnormal program termination if offsets do not hold league_size + 1
+// entries.
+void team_policy_check_work_offsets(
+    int league_size, const Kokkos::Experimental::WorkOffsets& offsets);
+
+}  // namespace Impl
+
 /** \brief  Execution policy for parallel work over a league of teams of
  * threads.
  *
@@ -673,6 +743,35 @@ class TeamPolicy
       : internal_policy(league_size_request, team_size_request,
                         Kokkos::AUTO()) {}
 
+  /** \brief  Construct policy balancing the work given by offsets over the
+   *  teams, see Kokkos::Experimental::WorkOffsets
+   */
+  TeamPolicy(const typename traits::execution_space& space_,
+             int league_size_request, int team_size_request,
+             const Kokkos::Experimental::WorkOffsets& offsets)
+      : internal_policy(space_, league_size_request, team_size_request) {
+    set_work_offsets(offsets);
+  }
+
+  TeamPolicy(const typename traits::execution_space& space_,
+             int league_size_request, const Kokkos::AUTO_t&,
+             const Kokkos::Experimental::WorkOffsets& offsets)
+      : internal_policy(space_, league_size_request, Kokkos::AUTO()) {
+    set_work_offsets(offsets);
+  }
+
+  TeamPolicy(int league_size_request, int team_size_request,
+             const Kokkos::Experimental::WorkOffsets& offsets)
+      : internal_policy(league_size_request, team_size_request) {
+    set_work_offsets(offsets);
+  }
+
+  TeamPolicy(int league_size_request, const Kokkos::AUTO_t&,
+             const Kokkos::Experimental::WorkOffsets& offsets)
+      : internal_policy(league_size_request, Kokkos::AUTO()) {
+    set_work_offsets(offsets);
+  }
+
   template <class... OtherProperties>
   TeamPolicy(const TeamPolicy<OtherProperties...> p) : internal_policy(p) {
     // Cannot call converting constructor in the member initializer list because
@@ -691,6 +790,17 @@ class TeamPolicy
     return static_cast<TeamPolicy&>(internal_policy::set_chunk_size(chunk));
   }
 
+  inline TeamPolicy& set_work_offsets(
+      const Kokkos::Experimental::WorkOffsets& offsets) {
+    Impl::team_policy_check_work_offsets(internal_policy::league_size(),
+                                         offsets);
+    if constexpr (Kokkos::is_detected_v<Impl::team_policy_set_work_offsets_t,
+                                        internal_policy>) {
+      internal_policy::impl_set_work_offsets(offsets);
+    }
+    return *this;
+  }
+
   inline TeamPolicy& set_scratch_size(const int& level,
                                       const Impl::PerTeamValue& per_team) {
     static_assert(std::is_same<decltype(internal_policy::set_scratch_size(
@@ -734,6 +844,10 @@ TeamPolicy(int, Kokkos::AUTO_t const&) -> TeamPolicy<>;
 TeamPolicy(int, Kokkos::AUTO_t const&, int) -> TeamPolicy<>;
 TeamPolicy(int, Kokkos::AUTO_t const&, Kokkos::AUTO_t const&) -> TeamPolicy<>;
 TeamPolicy(int, int, Kokkos::AUTO_t const&) -> TeamPolicy<>;
+TeamPolicy(int, int, Kokkos::Experimental::WorkOffsets const&)
+    -> TeamPolicy<>;
+TeamPolicy(int, Kokkos::AUTO_t const&, Kokkos::Experimental::WorkOffsets const&)
+    -> TeamPolicy<>;
 
 // DefaultExecutionSpace deduces to TeamPolicy<>
 
@@ -747,6 +861,10 @@ TeamPolicy(DefaultExecutionSpace const&, int, Kokkos::AUTO_t const&,
            Kokkos::AUTO_t const&) -> TeamPolicy<>;
 TeamPolicy(DefaultExecutionSpace const&, int, int, Kokkos::AUTO_t const&)
     -> TeamPolicy<>;
+TeamPolicy(DefaultExecutionSpace const&, int, int,
+           Kokkos::Experimental::WorkOffsets const&) -> TeamPolicy<>;
+TeamPolicy(DefaultExecutionSpace const&, int, Kokkos::AUTO_t const&,
+           Kokkos::Experimental::WorkOffsets const&) -> TeamPolicy<>;
 
 // ES != DefaultExecutionSpace deduces to TeamPolicy<ES>
 
@@ -775,6 +893,16 @@ template <typename ES,
           typename = std::enable_if_t<Kokkos::is_execution_space_v<ES>>>
 TeamPolicy(ES const&, int, int, Kokkos::AUTO_t const&) -> TeamPolicy<ES>;
 
+template <typename ES,
+          typename = std::enable_if_t<Kokkos::is_execution_space_v<ES>>>
+TeamPolicy(ES const&, int, int, Kokkos::Experimental::WorkOffsets const&)
+    -> TeamPolicy<ES>;
+
+template <typename ES,
+          typename = std::enable_if_t<Kokkos::is_execution_space_v<ES>>>
+TeamPolicy(ES const&, int, Kokkos::AUTO_t const&,
+           Kokkos::Experimental::WorkOffsets const&) -> TeamPolicy<ES>;
+
 namespace Impl {
 
 template <typename iType, class TeamMemberType>
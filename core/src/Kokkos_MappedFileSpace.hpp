@@ -0,0 +1,209 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#include <Kokkos_Macros.hpp>
+static_assert(false,
+              "Including non-public Kokkos header files is not allowed.");
+#endif
+#ifndef KOKKOS_MAPPEDFILESPACE_HPP
+#define KOKKOS_MAPPEDFILESPACE_HPP
+
+#include <string>
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_Concepts.hpp>
+#include <Kokkos_HostSpace.hpp>
+
+#include <impl/Kokkos_SharedAlloc.hpp>
+#include <impl/Kokkos_Tools.hpp>
+
+/*--------------------------------------------------------------------------*/
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class MappedFileSpace
+/// \brief Host memory backed by a memory-mapped file.
+///
+/// Each allocation maps the file at 'path' from offset zero, so the pages
+/// are loaded lazily and shared with other processes through the page
+/// cache.  A default constructed MappedFileSpace maps anonymous memory.
+///
+/// Allocating a View initializes its memory unless Kokkos::WithoutInitializing
+/// is given, which is required for Mode::read_only and overwrites the file
+/// for Mode::read_write.  Writable shared maps are flushed to the file with
+/// msync when the allocation is released.
+///
+/// \code
+///   using space_type = Kokkos::Experimental::MappedFileSpace;
+///   Kokkos::View<double*, space_type> table(
+///       Kokkos::view_alloc(space_type("table.bin"),
+///                          Kokkos::WithoutInitializing, "table"),
+///       n);
+/// \endcode
+class MappedFileSpace {
+ public:
+  //! Tag this class as a kokkos memory space
+  using memory_space    = MappedFileSpace;
+  using size_type       = size_t;
+  using execution_space = DefaultHostExecutionSpace;
+  using device_type     = Kokkos::Device<execution_space, memory_space>;
+
+  enum class Mode {
+    read_only,      ///< Map an existing file read-only and shared
+    read_write,     ///< Map an existing file shared, extended if too small
+    create,         ///< Create or truncate the file to the allocation size
+    copy_on_write,  ///< Map an existing file privately, writes are not saved
+  };
+
+  enum class Advice {
+    normal,      ///< Default kernel read-ahead
+    sequential,  ///< Aggressive read-ahead, pages freed soon after access
+    random,      ///< No read-ahead
+    will_need,   ///< Start reading the whole mapping ahead of use
+  };
+
+  MappedFileSpace()                                  = default;
+  MappedFileSpace(MappedFileSpace&& rhs)             = default;
+  MappedFileSpace(const MappedFileSpace& rhs)        = default;
+  MappedFileSpace& operator=(MappedFileSpace&&)      = default;
+  MappedFileSpace& operator=(const MappedFileSpace&) = default;
+  ~MappedFileSpace()                                 = default;
+
+  /**\brief  Map 'path' for every allocation in this space.
+   *
+   *  If 'populate' is true the whole mapping is faulted in
+   *  when it is created (MAP_POPULATE where available).
+   */
+  explicit MappedFileSpace(std::string path, Mode mode = Mode::read_only,
+                           Advice advice = Advice::normal,
+                           bool populate = false)
+      : m_path(std::move(path)),
+        m_mode(mode),
+        m_advice(advice),
+        m_populate(populate) {}
+
+  const std::string& path() const { return m_path; }
+  Mode mode() const { return m_mode; }
+  Advice advice() const { return m_advice; }
+  bool populate() const { return m_populate; }
+
+  /**\brief  Allocate untracked memory in the space */
+  template <typename ExecutionSpace>
+  void* allocate(const ExecutionSpace&, const size_t arg_alloc_size) const {
+    return allocate(arg_alloc_size);
+  }
+  template <typename ExecutionSpace>
+  void* allocate(const ExecutionSpace&, const char* arg_label,
+                 const size_t arg_alloc_size,
+                 const size_t arg_logical_size = 0) const {
+    return allocate(arg_label, arg_alloc_size, arg_logical_size);
+  }
+  void* allocate(const size_t arg_alloc_size) const;
+  void* allocate(const char* arg_label, const size_t arg_alloc_size,
+                 const size_t arg_logical_size = 0) const;
+
+  /**\brief  Deallocate untracked memory in the space */
+  void deallocate(void* const arg_alloc_ptr, const size_t arg_alloc_size) const;
+  void deallocate(const char* arg_label, void* const arg_alloc_ptr,
+                  const size_t arg_alloc_size,
+                  const size_t arg_logical_size = 0) const;
+
+  /**\brief Return Name of the MemorySpace */
+  static constexpr const char* name() { return m_name; }
+
+ private:
+  void* impl_allocate(const char* arg_label, const size_t arg_alloc_size,
+                      const size_t arg_logical_size = 0,
+                      const Kokkos::Tools::SpaceHandle =
+                          Kokkos::Tools::make_space_handle(name())) const;
+  void impl_deallocate(const char* arg_label, void* const arg_alloc_ptr,
+                       const size_t arg_alloc_size,
+                       const size_t arg_logical_size = 0,
+                       const Kokkos::Tools::SpaceHandle =
+                           Kokkos::Tools::make_space_handle(name())) const;
+
+  std::string m_path;
+  Mode m_mode     = Mode::read_only;
+  Advice m_advice = Advice::normal;
+  bool m_populate = false;
+
+  static constexpr const char* m_name = "MappedFile";
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+template <>
+struct MemorySpaceAccess<Kokkos::HostSpace,
+                         Kokkos::Experimental::MappedFileSpace> {
+  enum : bool { assignable = false };
+  enum : bool { accessible = true };
+  enum : bool { deepcopy = true };
+};
+
+template <>
+struct MemorySpaceAccess<Kokkos::Experimental::MappedFileSpace,
+                         Kokkos::HostSpace> {
+  enum : bool { assignable = false };
+  enum : bool { accessible = true };
+  enum : bool { deepcopy = true };
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+//----------------------------------------------------------------------------
+
+KOKKOS_IMPL_SHARED_ALLOCATION_SPECIALIZATION(
+    Kokkos::Experimental::MappedFileSpace);
+
+//----------------------------------------------------------------------------
+
+namespace Kokkos {
+namespace Impl {
+
+template <class ExecutionSpace>
+struct DeepCopy<Kokkos::Experimental::MappedFileSpace,
+                Kokkos::Experimental::MappedFileSpace, ExecutionSpace>
+    : DeepCopy<HostSpace, HostSpace, ExecutionSpace> {
+  using DeepCopy<HostSpace, HostSpace, ExecutionSpace>::DeepCopy;
+};
+
+template <class ExecutionSpace>
+struct DeepCopy<Kokkos::Experimental::MappedFileSpace, HostSpace,
+                ExecutionSpace>
+    : DeepCopy<HostSpace, HostSpace, ExecutionSpace> {
+  using DeepCopy<HostSpace, HostSpace, ExecutionSpace>::DeepCopy;
+};
+
+template <class ExecutionSpace>
+struct DeepCopy<HostSpace, Kokkos::Experimental::MappedFileSpace,
+                ExecutionSpace>
+    : DeepCopy<HostSpace, HostSpace, ExecutionSpace> {
+  using DeepCopy<HostSpace, HostSpace, ExecutionSpace>::DeepCopy;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif  // #define KOKKOS_MAPPEDFILESPACE_HPP
@@ -57,6 +57,21 @@ void _print_memory_pool_state(std::ostream &s, uint32_t const *sb_state_ptr,
                               uint32_t sb_state_size, uint32_t state_shift,
                               uint32_t state_used_mask);
 
+/* Index of the calling host thread, the value acquired by a
+ * UniqueToken< DefaultHostExecutionSpace , UniqueTokenScope::Global >
+ * without constructing an execution space instance per call.
+ * Deferred until the pool is instantiated, when the host
+ * execution space is a complete type.
+ */
+template <typename DeviceType>
+struct MemoryPoolHostThread {
+  using space = std::conditional_t<std::is_void_v<DeviceType>, void,
+                                   Kokkos::DefaultHostExecutionSpace>;
+
+  static int count() { return space::impl_max_hardware_threads(); }
+  static int id() { return space::impl_hardware_thread_id(); }
+};
+
 }  // end namespace Impl
 
 template <typename DeviceType>
@@ -73,6 +88,26 @@ class MemoryPool {
 
   enum : uint32_t { HINT_PER_BLOCK_SIZE = 2 };
 
+  /*  Allocations from the host of small block sizes go through
+   *  per-thread caches of free blocks, indexed by the host thread id.
+   *  Each cache is a lock word, a count per block size and a
+   *  stack of block ids per block size:
+   *    [ { lock , count[ CACHE_HEADER_SIZE - 1 ] }
+   *    , { block_id[ CACHE_CAPACITY ] }* ]
+   *  A block id is the block's offset into the superblock data
+   *  in units of the minimum block size.
+   *
+   *  An empty cache is refilled with CACHE_BATCH blocks claimed from
+   *  one superblock with a single update of the used count.
+   *  A full cache returns its CACHE_BATCH oldest blocks to the superblocks.
+   *  Cached blocks remain allocated in the superblocks' bitsets.
+   */
+
+  enum : uint32_t { CACHE_HEADER_SIZE = 16 /* 64 bytes */ };
+  enum : uint32_t { CACHE_CAPACITY = 64 };
+  enum : uint32_t { CACHE_BATCH = 32 };
+  enum : uint32_t { CACHE_BATCH_LG2 = 5 };
+
   /*  Each superblock has a concurrent bitset state
    *  which is an array of uint32_t integers.
    *    [ { block_count_lg2  : state_shift bits
@@ -112,7 +147,10 @@ class MemoryPool {
   int32_t m_sb_count;
   int32_t m_hint_offset;  // Offset to K * #block_size array of hints
   int32_t m_data_offset;  // Offset to 0th superblock data
-  int32_t m_unused_padding;
+  int32_t m_cache_offset;       // Offset to per-thread block caches
+  uint32_t m_cache_size;        // Size of one per-thread block cache
+  int32_t m_cache_count;        // Number of per-thread block caches
+  uint32_t m_cache_block_sizes;  // Number of cached block sizes
 
  public:
   using memory_space = typename DeviceType::memory_space;
@@ -202,6 +240,21 @@ class MemoryPool {
       }
     }
 
+    // Blocks held in per-thread caches are reserved, not consumed
+
+    for (int32_t i = 0; i < m_cache_count; ++i) {
+      const uint32_t volatile *const cache = thread_cache(i);
+
+      for (uint32_t c = 0; c < m_cache_block_sizes; ++c) {
+        const size_t cached = cache[1 + c];
+
+        stats.consumed_blocks -= cached;
+        stats.consumed_bytes -= cached << (m_min_block_size_lg2 + c);
+        stats.reserved_blocks += cached;
+        stats.reserved_bytes += cached << (m_min_block_size_lg2 + c);
+      }
+    }
+
     if (!accessible) {
       host.deallocate(sb_state_array, alloc_size);
     }
@@ -249,7 +302,10 @@ class MemoryPool {
         m_sb_count(0),
         m_hint_offset(0),
         m_data_offset(0),
-        m_unused_padding(0) {}
+        m_cache_offset(0),
+        m_cache_size(0),
+        m_cache_count(0),
+        m_cache_block_sizes(0) {}
 
   /**\brief  Allocate a memory pool from 'memspace'.
    *
@@ -277,7 +333,10 @@ class MemoryPool {
         m_sb_count(0),
         m_hint_offset(0),
         m_data_offset(0),
-        m_unused_padding(0) {
+        m_cache_offset(0),
+        m_cache_size(0),
+        m_cache_count(0),
+        m_cache_block_sizes(0) {
     const uint32_t int_align_lg2               = 3; /* align as int[8] */
     const uint32_t int_align_mask              = (1u << int_align_lg2) - 1;
     const uint32_t default_min_block_size      = 1u << 6;  /* 64 bytes */
@@ -383,11 +442,35 @@ class MemoryPool {
     m_hint_offset = all_sb_state_size;
     m_data_offset = m_hint_offset + block_size_array_size * HINT_PER_BLOCK_SIZE;
 
-    // Allocation:
+    // Per-thread caches for the block sizes with at least CACHE_BATCH
+    // blocks per superblock, when the host can access the pool
+    // and block ids fit in 32 bits.
+
+    if (accessible &&
+        (size_t(m_sb_count) << (m_sb_size_lg2 - m_min_block_size_lg2)) <=
+            size_t(~uint32_t(0))) {
+      while (m_cache_block_sizes < uint32_t(number_block_sizes) &&
+             m_cache_block_sizes + 1 < CACHE_HEADER_SIZE &&
+             CACHE_BATCH_LG2 + m_min_block_size_lg2 + m_cache_block_sizes <=
+                 m_sb_size_lg2) {
+        ++m_cache_block_sizes;
+      }
+    }
+
+    if (m_cache_block_sizes) {
+      m_cache_offset = m_data_offset;
+      m_cache_size   = CACHE_HEADER_SIZE + m_cache_block_sizes * CACHE_CAPACITY;
+      m_cache_count  = host_thread::count();
+      m_data_offset  = m_cache_offset + m_cache_count * m_cache_size;
+    }
+
+    // Allocation, with room to align the superblocks
+    // to the maximum block size:
 
     const size_t header_size = m_data_offset * sizeof(uint32_t);
-    const size_t alloc_size =
-        header_size + (size_t(m_sb_count) << m_sb_size_lg2);
+    const size_t alloc_size  = header_size +
+                              (size_t(m_sb_count) << m_sb_size_lg2) +
+                              (size_t(1) << m_max_block_size_lg2);
 
     Record *rec = Record::allocate(memspace, "Kokkos::MemoryPool", alloc_size);
 
@@ -395,12 +478,22 @@ class MemoryPool {
 
     m_sb_state_array = (uint32_t *)rec->data();
 
+    {
+      const uintptr_t data_mask = (uintptr_t(1) << m_max_block_size_lg2) - 1;
+      const uintptr_t data      = uintptr_t(m_sb_state_array + m_data_offset);
+
+      m_data_offset += ((data_mask + 1 - (data & data_mask)) & data_mask) /
+                       sizeof(uint32_t);
+    }
+
     Kokkos::HostSpace host;
 
     uint32_t *const sb_state_array =
         accessible ? m_sb_state_array : (uint32_t *)host.allocate(header_size);
 
-    for (int32_t i = 0; i < m_data_offset; ++i) sb_state_array[i] = 0;
+    for (size_t i = 0; i < header_size / sizeof(uint32_t); ++i) {
+      sb_state_array[i] = 0;
+    }
 
     // Initial assignment of empty superblocks to block sizes:
 
@@ -465,8 +558,8 @@ class MemoryPool {
   //--------------------------------------------------------------------------
   /**\brief  Allocate a block of memory that is at least 'alloc_size'
    *
-   *  The block of memory is aligned to the minimum block size,
-   *  currently is 64 bytes, will never be less than 32 bytes.
+   *  The block of memory is aligned to its block size, the smallest
+   *  power of two that is at least 'alloc_size' and the minimum block size.
    *
    *  If concurrent allocations and deallocations are taking place
    *  then a single allocation attempt may fail due to lack of available space.
@@ -482,10 +575,43 @@ class MemoryPool {
 
     if (0 == alloc_size) return nullptr;
 
-    void *p = nullptr;
-
     const uint32_t block_size_lg2 = get_block_size_lg2(alloc_size);
 
+    KOKKOS_IF_ON_HOST((if (is_cached_block_size(block_size_lg2)) {
+      return allocate_cached(block_size_lg2, attempt_limit);
+    }))
+
+    uint32_t extra_count = 0;
+
+    void *p =
+        allocate_block(block_size_lg2, attempt_limit, nullptr, extra_count);
+
+    // Blocks held in the caches may be keeping superblocks
+    // from being reassigned to this block size.
+    KOKKOS_IF_ON_HOST((if (nullptr == p && m_cache_block_sizes) {
+      flush_thread_caches(nullptr);
+
+      p = allocate_block(block_size_lg2, attempt_limit, nullptr, extra_count);
+    }))
+
+    return p;
+  }
+  // end allocate
+  //--------------------------------------------------------------------------
+
+ private:
+  /*  Allocate a block of size ( 1 << block_size_lg2 ) from the superblocks.
+   *  If 'extra_count' is not zero, also claim up to that many
+   *  blocks of the same size from the same superblock, write their
+   *  block ids to 'extra_block_id' and set 'extra_count' to the
+   *  number claimed.
+   */
+  KOKKOS_FUNCTION
+  void *allocate_block(uint32_t const block_size_lg2, int32_t attempt_limit,
+                       uint32_t *const extra_block_id,
+                       uint32_t &extra_count) const noexcept {
+    void *p = nullptr;
+
     // Allocation will fit within a superblock
     // that has block sizes ( 1 << block_size_lg2 )
 
@@ -569,6 +695,33 @@ class MemoryPool {
               (uint64_t(sb_id) << m_sb_size_lg2)       // superblock memory
               + (uint64_t(result.first) << size_lg2);  // block memory
 
+          if (extra_count) {
+            // Claim more blocks from this superblock, only if it
+            // is assigned to the requested block size.
+
+            uint32_t n = sb_state == block_state ? extra_count : 0;
+
+            for (; n; n >>= 1) {
+              const Kokkos::pair<int, int> extra = CB::acquire_bounded_lg2_n(
+                  sb_state_array, count_lg2, n, extra_block_id, result.first,
+                  sb_state);
+
+              if (0 <= extra.first) break;
+              if (-1 != extra.first) n = 1;  // Wrong state, give up
+            }
+
+            const uint32_t sb_block_id =
+                uint32_t(sb_id) << (m_sb_size_lg2 - m_min_block_size_lg2);
+
+            for (uint32_t i = 0; i < n; ++i) {
+              extra_block_id[i] =
+                  sb_block_id +
+                  (extra_block_id[i] << (size_lg2 - m_min_block_size_lg2));
+            }
+
+            extra_count = n;
+          }
+
           break;  // Success
         }
       }
@@ -694,11 +847,12 @@ class MemoryPool {
     }  // end allocation attempt loop
     //--------------------------------------------------------------------
 
+    if (nullptr == p) extra_count = 0;
+
     return p;
   }
-  // end allocate
-  //--------------------------------------------------------------------------
 
+ public:
   /**\brief  Return an allocated block of memory to the pool.
    *
    *  Requires: p is return value from allocate( alloc_size );
@@ -741,9 +895,20 @@ class MemoryPool {
         const uint32_t bit =
             (d & (ptrdiff_t(1LU << m_sb_size_lg2) - 1)) >> block_size_lg2;
 
-        const int result = CB::release(sb_state_array, bit, block_state);
+        int cached = 0;
+
+        KOKKOS_IF_ON_HOST((if (is_cached_block_size(block_size_lg2)) {
+          cached = deallocate_cached(uint32_t(d >> m_min_block_size_lg2),
+                                     block_size_lg2, sb_state_array, bit);
+        }))
 
-        ok_dealloc_once = 0 <= result;
+        if (cached) {
+          ok_dealloc_once = 0 < cached;
+        } else {
+          const int result = CB::release(sb_state_array, bit, block_state);
+
+          ok_dealloc_once = 0 <= result;
+        }
       }
     }
 
@@ -754,6 +919,200 @@ class MemoryPool {
   // end deallocate
   //--------------------------------------------------------------------------
 
+  /**\brief  Return the blocks held in the per-thread caches
+   *          to their superblocks and release the superblocks
+   *          left empty from their block size.
+   *
+   *  Caches in use by a concurrent allocate or deallocate are skipped.
+   *  Does nothing for pools the host cannot access.
+   */
+  void flush_thread_caches() const noexcept {
+    if (accessible) flush_thread_caches(nullptr);
+  }
+
+ private:
+  using host_thread = Impl::MemoryPoolHostThread<DeviceType>;
+
+  KOKKOS_INLINE_FUNCTION
+  bool is_cached_block_size(uint32_t const block_size_lg2) const noexcept {
+    return block_size_lg2 - m_min_block_size_lg2 < m_cache_block_sizes;
+  }
+
+  uint32_t *thread_cache(int32_t const i) const noexcept {
+    return m_sb_state_array + m_cache_offset + i * m_cache_size;
+  }
+
+  /*  Lock the calling thread's cache, return nullptr if it is in use.
+   *  Host thread ids are not exclusive outside of a parallel region,
+   *  the lock is.
+   */
+  uint32_t *acquire_thread_cache() const noexcept {
+    const int32_t i = host_thread::id();
+
+    if (i < 0 || m_cache_count <= i) return nullptr;
+
+    uint32_t *const cache = thread_cache(i);
+
+    return try_lock_thread_cache(cache) ? cache : nullptr;
+  }
+
+  static bool try_lock_thread_cache(uint32_t *const cache) noexcept {
+    uint32_t unlocked = 0;
+    return Kokkos::Impl::atomic_compare_exchange_strong(
+        cache, unlocked, uint32_t(1), desul::MemoryOrderAcquire(),
+        desul::MemoryOrderRelaxed());
+  }
+
+  static void release_thread_cache(uint32_t *const cache) noexcept {
+    Kokkos::Impl::atomic_store(cache, uint32_t(0), desul::MemoryOrderRelease());
+  }
+
+  /*  Return the 'n' oldest blocks of cached block size 'c'
+   *  to their superblocks.  Requires the cache to be locked.
+   */
+  void drain_thread_cache(uint32_t *const cache, uint32_t const c,
+                          uint32_t const n) const noexcept {
+    const uint32_t block_size_lg2 = m_min_block_size_lg2 + c;
+    const uint32_t block_state = (m_sb_size_lg2 - block_size_lg2)
+                                 << state_shift;
+    const uint64_t sb_mask = (uint64_t(1) << m_sb_size_lg2) - 1;
+
+    uint32_t &count        = cache[1 + c];
+    uint32_t *const blocks = cache + CACHE_HEADER_SIZE + c * CACHE_CAPACITY;
+
+    for (uint32_t i = 0; i < n; ++i) {
+      const uint64_t d    = uint64_t(blocks[i]) << m_min_block_size_lg2;
+      const uint32_t bit  = (d & sb_mask) >> block_size_lg2;
+      const int32_t sb_id = d >> m_sb_size_lg2;
+
+      if (CB::release(m_sb_state_array + (sb_id * m_sb_state_size), bit,
+                      block_state) < 0) {
+        Kokkos::abort("Kokkos MemoryPool::deallocate given erroneous pointer");
+      }
+    }
+
+    for (uint32_t i = n; i < count; ++i) blocks[i - n] = blocks[i];
+
+    count -= n;
+  }
+
+  void flush_thread_caches(uint32_t *const locked_cache) const noexcept {
+    for (int32_t i = 0; i < m_cache_count; ++i) {
+      uint32_t *const cache = thread_cache(i);
+
+      const bool locked =
+          cache == locked_cache || try_lock_thread_cache(cache);
+
+      if (locked) {
+        for (uint32_t c = 0; c < m_cache_block_sizes; ++c) {
+          drain_thread_cache(cache, c, cache[1 + c]);
+        }
+        if (cache != locked_cache) release_thread_cache(cache);
+      }
+    }
+
+    // Superblocks without allocated blocks return to the unassigned
+    // state, a concurrent allocation from one makes the exchange fail.
+
+    for (int32_t i = 0; i < m_sb_count; ++i) {
+      volatile uint32_t *const sb_state_array =
+          m_sb_state_array + (i * m_sb_state_size);
+
+      const uint32_t state = *sb_state_array;
+
+      if (state && 0 == (state & state_used_mask)) {
+        Kokkos::atomic_compare_exchange(sb_state_array, state, uint32_t(0));
+      }
+    }
+  }
+
+  void *allocate_cached(uint32_t const block_size_lg2,
+                        int32_t const attempt_limit) const noexcept {
+    uint32_t *const cache = acquire_thread_cache();
+
+    uint32_t extra_count = 0;
+
+    if (nullptr == cache) {
+      return allocate_block(block_size_lg2, attempt_limit, nullptr,
+                            extra_count);
+    }
+
+    const uint32_t c       = block_size_lg2 - m_min_block_size_lg2;
+    uint32_t &count        = cache[1 + c];
+    uint32_t *const blocks = cache + CACHE_HEADER_SIZE + c * CACHE_CAPACITY;
+
+    void *p = nullptr;
+
+    if (count) {
+      p = ((char *)(m_sb_state_array + m_data_offset)) +
+          (uint64_t(blocks[--count]) << m_min_block_size_lg2);
+    } else {
+      extra_count = CACHE_BATCH - 1;
+
+      p = allocate_block(block_size_lg2, attempt_limit, blocks, extra_count);
+
+      count = extra_count;
+
+      if (nullptr == p) {
+        // Blocks held in the caches may be keeping superblocks
+        // from being reassigned to this block size.
+
+        flush_thread_caches(cache);
+
+        extra_count = 0;
+
+        p = allocate_block(block_size_lg2, attempt_limit, nullptr,
+                           extra_count);
+      }
+    }
+
+    release_thread_cache(cache);
+
+    return p;
+  }
+
+  /*  Park a block in the calling thread's cache.
+   *  Return 1 if the block was cached, 0 if the cache is in use,
+   *  and -1 if the block is not allocated or is already in the cache.
+   *  A block already held in another thread's cache is not detected.
+   */
+  int deallocate_cached(uint32_t const block_id, uint32_t const block_size_lg2,
+                        volatile uint32_t *const sb_state_array,
+                        uint32_t const bit) const noexcept {
+    const uint32_t mask = 1u << (bit & CB::bits_per_int_mask);
+
+    if (!(sb_state_array[1 + (bit >> CB::bits_per_int_lg2)] & mask)) {
+      return -1;
+    }
+
+    uint32_t *const cache = acquire_thread_cache();
+
+    if (nullptr == cache) return 0;
+
+    const uint32_t c       = block_size_lg2 - m_min_block_size_lg2;
+    uint32_t *const blocks = cache + CACHE_HEADER_SIZE + c * CACHE_CAPACITY;
+
+    int result = 1;
+
+    for (uint32_t i = 0; i < cache[1 + c]; ++i) {
+      if (blocks[i] == block_id) result = -1;
+    }
+
+    if (0 < result) {
+      if (CACHE_CAPACITY == cache[1 + c]) {
+        drain_thread_cache(cache, c, CACHE_BATCH);
+      }
+
+      blocks[cache[1 + c]++] = block_id;
+    }
+
+    release_thread_cache(cache);
+
+    return result;
+  }
+
+ public:
+
   KOKKOS_INLINE_FUNCTION
   int number_of_superblocks() const noexcept { return m_sb_count; }
 
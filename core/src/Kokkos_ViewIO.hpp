@@ -0,0 +1,259 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_VIEWIO_HPP
+#define KOKKOS_VIEWIO_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_VIEWIO
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_TypeInfo.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace Kokkos {
+namespace Impl {
+
+/*  A View file is
+ *    [ ViewFileHeader zero padded to 'data_offset' bytes | span of the View ]
+ *  Integers are stored in the byte order of the writer.  The span is
+ *  always contiguous; its layout is given by the recorded strides.
+ */
+struct ViewFileHeader {
+  enum : uint32_t { version_value = 1 };
+  enum : size_t { data_offset = 4096 };
+
+  char magic[8];
+  uint32_t version;
+  uint32_t rank;
+  uint64_t value_size;
+  uint64_t span_size;  // in bytes
+  uint64_t extent[ARRAY_LAYOUT_MAX_RANK];
+  uint64_t stride[ARRAY_LAYOUT_MAX_RANK];
+  char value_type[256];
+  char label[1024];
+};
+
+static_assert(sizeof(ViewFileHeader) <= ViewFileHeader::data_offset);
+
+/** \brief  Write 'header' followed by 'header.span_size' bytes of 'data'.
+ *
+ *  Without O_DIRECT support, or if the file system rejects it,
+ *  'direct_io' is ignored.
+ */
+void view_file_write(const std::string& path, ViewFileHeader header,
+                     const void* data, bool direct_io);
+
+ViewFileHeader view_file_read_header(const std::string& path);
+
+/** \brief  Read the span of the file into 'data', which must be host
+ *          accessible, in parallel on the DefaultHostExecutionSpace.
+ */
+void view_file_read(const std::string& path, const ViewFileHeader& header,
+                    void* data);
+
+template <class ViewType>
+ViewFileHeader make_view_file_header(const ViewType& view) {
+  using value_type = typename ViewType::non_const_value_type;
+
+  constexpr std::string_view type_name = TypeInfo<value_type>::name();
+
+  ViewFileHeader header{};
+  std::memcpy(header.magic, "KOKKOSVW", sizeof(header.magic));
+  header.version    = ViewFileHeader::version_value;
+  header.rank       = ViewType::rank();
+  header.value_size = sizeof(value_type);
+  header.span_size  = view.span() * sizeof(value_type);
+  for (unsigned r = 0; r < ViewType::rank(); ++r) {
+    header.extent[r] = view.extent(r);
+    header.stride[r] = view.stride(r);
+  }
+  type_name.copy(header.value_type, sizeof(header.value_type) - 1);
+  view.label().copy(header.label, sizeof(header.label) - 1);
+  return header;
+}
+
+template <class ViewType>
+void check_view_file_header(const std::string& path,
+                            const ViewFileHeader& header) {
+  const ViewFileHeader expected = make_view_file_header(ViewType());
+
+  if (header.rank != expected.rank ||
+      header.value_size != expected.value_size ||
+      std::strcmp(header.value_type, expected.value_type) != 0) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::read_view: '" + path + "' holds a rank " +
+        std::to_string(header.rank) + " View of '" + header.value_type +
+        "', expected rank " + std::to_string(expected.rank) + " of '" +
+        expected.value_type + "'");
+  }
+}
+
+/*  Layout of a View allocated to hold the file: LayoutLeft and
+ *  LayoutRight take the extents, LayoutStride also the recorded strides.
+ */
+template <class Layout>
+Layout view_file_layout(const ViewFileHeader& header) {
+  Layout layout;
+  for (unsigned r = 0; r < header.rank; ++r) {
+    layout.dimension[r] = header.extent[r];
+    if constexpr (std::is_same_v<Layout, LayoutStride>) {
+      layout.stride[r] = header.stride[r];
+    }
+  }
+  return layout;
+}
+
+template <class ViewType>
+bool view_matches_file(const ViewType& view, const ViewFileHeader& header) {
+  if (!view.is_allocated() ||
+      view.span() * sizeof(typename ViewType::value_type) != header.span_size)
+    return false;
+  for (unsigned r = 0; r < header.rank; ++r) {
+    if (view.extent(r) != header.extent[r]) return false;
+  }
+  return true;
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/** \brief  Write 'view' to 'path' in a self-describing binary format
+ *          recording its label, extents, strides and value type.
+ *
+ *  A host accessible View with a contiguous span is streamed to the file
+ *  directly; other Views are first copied to a contiguous host View.
+ *  If 'direct_io' is true the file is written with O_DIRECT where
+ *  supported, bypassing the page cache.
+ */
+template <class DataType, class... Properties>
+void write_view(const std::string& path,
+                const View<DataType, Properties...>& view,
+                bool direct_io = false) {
+  using view_type    = View<DataType, Properties...>;
+  using array_layout = typename view_type::array_layout;
+
+  static_assert(std::is_same_v<array_layout, LayoutLeft> ||
+                    std::is_same_v<array_layout, LayoutRight> ||
+                    std::is_same_v<array_layout, LayoutStride>,
+                "Kokkos::Experimental::write_view: unsupported layout");
+
+  if constexpr (!SpaceAccessibility<
+                    HostSpace, typename view_type::memory_space>::accessible) {
+    write_view(path, create_mirror_view_and_copy(HostSpace(), view),
+               direct_io);
+  } else {
+    if (!view.span_is_contiguous()) {
+      using staged_layout =
+          std::conditional_t<std::is_same_v<array_layout, LayoutStride>,
+                             LayoutRight, array_layout>;
+      using staged_type = View<typename view_type::non_const_data_type,
+                               staged_layout, HostSpace>;
+
+      const Kokkos::Impl::ViewFileHeader header =
+          Kokkos::Impl::make_view_file_header(view);
+      staged_type staged(
+          view_alloc(WithoutInitializing, view.label()),
+          Kokkos::Impl::view_file_layout<staged_layout>(header));
+      deep_copy(staged, view);
+      write_view(path, staged, direct_io);
+      return;
+    }
+
+    typename view_type::execution_space().fence(
+        "Kokkos::Experimental::write_view: fence before writing");
+
+    Kokkos::Impl::view_file_write(path,
+                                  Kokkos::Impl::make_view_file_header(view),
+                                  view.data(), direct_io);
+  }
+}
+
+/** \brief  Read a View written by write_view from 'path' into 'view'.
+ *
+ *  If 'view' is not allocated with the recorded extents it is replaced by
+ *  a new View with the recorded label and extents.  New allocations are
+ *  not initialized; the file is read in parallel on the
+ *  DefaultHostExecutionSpace so pages are first touched by the threads
+ *  that will later use them.  The layout of 'view' may differ from the
+ *  one that was written.
+ */
+template <class DataType, class... Properties>
+void read_view(const std::string& path, View<DataType, Properties...>& view) {
+  using view_type    = View<DataType, Properties...>;
+  using array_layout = typename view_type::array_layout;
+
+  static_assert(!std::is_const_v<typename view_type::value_type>,
+                "Kokkos::Experimental::read_view: View must not be const");
+  static_assert(std::is_same_v<array_layout, LayoutLeft> ||
+                    std::is_same_v<array_layout, LayoutRight> ||
+                    std::is_same_v<array_layout, LayoutStride>,
+                "Kokkos::Experimental::read_view: unsupported layout");
+
+  const Kokkos::Impl::ViewFileHeader header =
+      Kokkos::Impl::view_file_read_header(path);
+
+  Kokkos::Impl::check_view_file_header<view_type>(path, header);
+
+  if (!Kokkos::Impl::view_matches_file(view, header)) {
+    view = view_type(view_alloc(WithoutInitializing, std::string(header.label)),
+                     Kokkos::Impl::view_file_layout<array_layout>(header));
+  }
+
+  bool same_strides = view.span_is_contiguous();
+  for (unsigned r = 0; r < header.rank; ++r) {
+    same_strides = same_strides && view.stride(r) == header.stride[r];
+  }
+
+  if constexpr (SpaceAccessibility<
+                    HostSpace, typename view_type::memory_space>::accessible) {
+    if (same_strides) {
+      typename view_type::execution_space().fence(
+          "Kokkos::Experimental::read_view: fence before reading");
+      Kokkos::Impl::view_file_read(path, header, view.data());
+      return;
+    }
+  }
+
+  View<typename view_type::non_const_data_type, LayoutStride, HostSpace>
+      staged(view_alloc(WithoutInitializing, std::string(header.label)),
+             Kokkos::Impl::view_file_layout<LayoutStride>(header));
+  if (!Kokkos::Impl::view_matches_file(staged, header)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::read_view: '" + path +
+        "' has inconsistent extents and strides");
+  }
+  Kokkos::Impl::view_file_read(path, header, staged.data());
+
+  auto mirror = create_mirror_view(WithoutInitializing, view);
+  deep_copy(mirror, staged);
+  deep_copy(view, mirror);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_VIEWIO
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_VIEWIO
+#endif
+#endif  // KOKKOS_VIEWIO_HPP
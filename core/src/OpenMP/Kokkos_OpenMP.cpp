@@ -50,7 +50,9 @@ int OpenMP::impl_get_current_max_threads() noexcept {
 
 void OpenMP::impl_initialize(InitializationSettings const &settings) {
   Impl::OpenMPInternal::singleton().initialize(
-      settings.has_num_threads() ? settings.get_num_threads() : -1);
+      settings.has_num_threads() ? settings.get_num_threads() : -1,
+      settings.has_host_scratch_reserve() ? settings.get_host_scratch_reserve()
+                                          : 0);
 }
 
 void OpenMP::impl_finalize() { Impl::OpenMPInternal::singleton().finalize(); }
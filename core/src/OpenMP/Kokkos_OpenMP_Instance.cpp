@@ -70,6 +70,17 @@ void OpenMPInternal::clear_thread_data() {
   /* END #pragma omp parallel */
 }
 
+namespace {
+
+// A buffer that is too small grows to at least twice its size, so kernels
+// asking for a little more scratch each time reallocate only a few times.
+size_t grow_scratch_bytes(size_t old_bytes, size_t new_bytes) {
+  return new_bytes <= old_bytes ? old_bytes
+                                : std::max(new_bytes, 2 * old_bytes);
+}
+
+}  // namespace
+
 void OpenMPInternal::resize_thread_data(size_t pool_reduce_bytes,
                                         size_t team_reduce_bytes,
                                         size_t team_shared_bytes,
@@ -95,18 +106,15 @@ void OpenMPInternal::resize_thread_data(size_t pool_reduce_bytes,
                         (old_thread_local < thread_local_bytes);
 
   if (allocate) {
-    if (pool_reduce_bytes < old_pool_reduce) {
-      pool_reduce_bytes = old_pool_reduce;
-    }
-    if (team_reduce_bytes < old_team_reduce) {
-      team_reduce_bytes = old_team_reduce;
-    }
-    if (team_shared_bytes < old_team_shared) {
-      team_shared_bytes = old_team_shared;
-    }
-    if (thread_local_bytes < old_thread_local) {
-      thread_local_bytes = old_thread_local;
-    }
+    Kokkos::Profiling::pushRegion("Kokkos::OpenMP::resize_thread_data");
+    Kokkos::Timer timer;
+    const bool grow = nullptr != root;
+
+    pool_reduce_bytes  = grow_scratch_bytes(old_pool_reduce, pool_reduce_bytes);
+    team_reduce_bytes  = grow_scratch_bytes(old_team_reduce, team_reduce_bytes);
+    team_shared_bytes  = grow_scratch_bytes(old_team_shared, team_shared_bytes);
+    thread_local_bytes =
+        grow_scratch_bytes(old_thread_local, thread_local_bytes);
 
     const size_t alloc_bytes =
         member_bytes +
@@ -125,16 +133,43 @@ void OpenMPInternal::resize_thread_data(size_t pool_reduce_bytes,
         space.impl_deallocate("[unlabeled]", m_pool[rank], old_alloc_bytes);
       }
 
-      void *ptr = space.allocate("Kokkos::OpenMP::scratch_mem", alloc_bytes);
+      m_pool[rank] = static_cast<HostThreadTeamData *>(
+          space.allocate("Kokkos::OpenMP::scratch_mem", alloc_bytes));
+    }
+
+    // Each thread sets up its own buffer so that the pages it touches first
+    // are placed in the NUMA domain of that thread.  The rest of the buffer
+    // is left untouched until a kernel uses it.
+    auto const first_touch = [&](const int rank) {
+      char *const ptr = reinterpret_cast<char *>(m_pool[rank]);
 
       m_pool[rank] = new (ptr) HostThreadTeamData();
 
-      m_pool[rank]->scratch_assign(((char *)ptr) + member_bytes, alloc_bytes,
+      m_pool[rank]->scratch_assign(ptr + member_bytes, alloc_bytes,
                                    pool_reduce_bytes, team_reduce_bytes,
                                    team_shared_bytes, thread_local_bytes);
+    };
+
+    if (omp_get_level() == m_level) {
+#pragma omp parallel num_threads(m_pool_size)
+      {
+        for (int rank = omp_get_thread_num(); rank < m_pool_size;
+             rank += omp_get_num_threads()) {
+          first_touch(rank);
+        }
+      }
+      /* END #pragma omp parallel */
+    } else {
+      for (int rank = 0; rank < m_pool_size; ++rank) first_touch(rank);
     }
 
     HostThreadTeamData::organize_pool(m_pool, m_pool_size);
+
+    if (grow) {
+      ++m_scratch_resize_count;
+      m_scratch_resize_seconds += timer.seconds();
+    }
+    Kokkos::Profiling::popRegion();
   }
 }
 
@@ -166,7 +201,7 @@ int OpenMPInternal::get_current_max_threads() noexcept {
   return count;
 }
 
-void OpenMPInternal::initialize(int thread_count) {
+void OpenMPInternal::initialize(int thread_count, int scratch_reserve) {
   if (m_initialized) {
     Kokkos::abort(
         "Calling OpenMP::initialize after OpenMP::finalize is illegal\n");
@@ -241,7 +276,10 @@ void OpenMPInternal::initialize(int thread_count) {
     {
       size_t pool_reduce_bytes  = 32 * thread_count;
       size_t team_reduce_bytes  = 32 * thread_count;
-      size_t team_shared_bytes  = 1024 * thread_count;
+      // Team kernels place the team and the thread scratch of all members
+      // in the team shared buffer
+      size_t team_shared_bytes  = std::max<size_t>(1024 * thread_count,
+                                                  scratch_reserve);
       size_t thread_local_bytes = 1024;
 
       instance.resize_thread_data(pool_reduce_bytes, team_reduce_bytes,
@@ -319,6 +357,12 @@ void OpenMPInternal::print_configuration(std::ostream &s) const {
 
     s << " thread_pool_topology[ " << numa_count << " x " << core_per_numa
       << " x " << thread_per_core << " ]" << std::endl;
+
+    const HostThreadTeamData *const root = m_pool[0];
+    s << "  thread scratch bytes: "
+      << (root ? root->scratch_bytes() : size_t(0))
+      << ", grown " << m_scratch_resize_count << " times in "
+      << m_scratch_resize_seconds << " s" << std::endl;
   } else {
     s << " not initialized" << std::endl;
   }
@@ -73,12 +73,17 @@ class OpenMPInternal {
 
   HostThreadTeamData* m_pool[OpenMPTraits::MAX_THREAD_COUNT];
 
+  int m_scratch_resize_count      = 0;
+  double m_scratch_resize_seconds = 0;
+
  public:
   friend class Kokkos::OpenMP;
 
   static OpenMPInternal& singleton();
 
-  void initialize(int thread_cound);
+  // scratch_reserve: team and thread scratch bytes, summed over the members
+  // of a team, that a team kernel can request before the buffers grow
+  void initialize(int thread_cound, int scratch_reserve = 0);
 
   void finalize();
 
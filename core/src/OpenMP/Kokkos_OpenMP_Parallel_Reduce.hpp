@@ -441,7 +441,9 @@ class ParallelReduce<CombinedFunctorReducerType,
 
       const int active = data.organize_team(m_policy.team_size());
 
-      if (active) {
+      if (active && 0 < m_policy.impl_work_offsets().size()) {
+        data.set_work_partition(m_policy.impl_work_offsets());
+      } else if (active) {
         data.set_work_partition(
             m_policy.league_size(),
             (0 < m_policy.chunk_size() ? m_policy.chunk_size()
@@ -53,6 +53,7 @@ class TeamPolicyInternal<Kokkos::OpenMP, Properties...>
     m_chunk_size             = p.m_chunk_size;
     m_tune_team              = p.m_tune_team;
     m_tune_vector            = p.m_tune_vector;
+    m_work_offsets           = p.m_work_offsets;
     m_space                  = p.m_space;
   }
   //----------------------------------------
@@ -117,6 +118,8 @@ class TeamPolicyInternal<Kokkos::OpenMP, Properties...>
   bool m_tune_team;
   bool m_tune_vector;
 
+  Kokkos::Experimental::WorkOffsets m_work_offsets;
+
   typename traits::execution_space m_space;
 
   inline void init(const int league_size_request, const int team_size_request) {
@@ -275,6 +278,16 @@ class TeamPolicyInternal<Kokkos::OpenMP, Properties...>
     return *this;
   }
 
+  inline const Kokkos::Experimental::WorkOffsets& impl_work_offsets() const {
+    return m_work_offsets;
+  }
+
+  inline TeamPolicyInternal& impl_set_work_offsets(
+      const Kokkos::Experimental::WorkOffsets& offsets) {
+    m_work_offsets = offsets;
+    return *this;
+  }
+
   /** \brief set per team scratch size for a specific level of the scratch
    * hierarchy */
   inline TeamPolicyInternal& set_scratch_size(const int& level,
@@ -67,6 +67,10 @@ std::pair<unsigned, unsigned>
 
 int s_thread_pool_size[3] = {0, 0, 0};
 
+// Scratch reallocations after the initial one and the time spent in them.
+int s_scratch_resize_count      = 0;
+double s_scratch_resize_seconds = 0;
+
 void (*volatile s_current_function)(ThreadsInternal &, const void *);
 const void *volatile s_current_function_arg = nullptr;
 
@@ -392,17 +396,38 @@ void *ThreadsInternal::resize_scratch(size_t reduce_size, size_t thread_size) {
 
   // Increase size or deallocate completely.
 
+  const bool deallocate = (reduce_size == 0 && thread_size == 0) &&
+                          (old_reduce_size != 0 || old_thread_size != 0);
+
   if ((old_reduce_size < reduce_size) || (old_thread_size < thread_size) ||
-      ((reduce_size == 0 && thread_size == 0) &&
-       (old_reduce_size != 0 || old_thread_size != 0))) {
+      deallocate) {
     verify_is_process("ThreadsInternal::resize_scratch", true);
 
+    Kokkos::Timer timer;
+    const bool grow = !deallocate && s_threads_process.m_scratch_thread_end;
+
+    // Grow by at least a factor of two and never shrink a part, so that
+    // kernels with alternating scratch needs settle on one allocation.
+    if (!deallocate) {
+      reduce_size = old_reduce_size < reduce_size
+                        ? std::max(reduce_size, 2 * old_reduce_size)
+                        : old_reduce_size;
+      thread_size = old_thread_size < thread_size
+                        ? std::max(thread_size, 2 * old_thread_size)
+                        : old_thread_size;
+    }
+
     s_threads_process.m_scratch_reduce_end = reduce_size;
     s_threads_process.m_scratch_thread_end = reduce_size + thread_size;
 
     execute_resize_scratch_in_serial();
 
     s_threads_process.m_scratch = s_threads_exec[0]->m_scratch;
+
+    if (grow) {
+      ++s_scratch_resize_count;
+      s_scratch_resize_seconds += timer.seconds();
+    }
   }
 
   return s_threads_process.m_scratch;
@@ -438,6 +463,9 @@ void ThreadsInternal::print_configuration(std::ostream &s, const bool detail) {
       s << " Asynchronous";
     }
     s << std::endl;
+    s << "  thread scratch bytes: " << s_threads_process.m_scratch_thread_end
+      << ", grown " << s_scratch_resize_count << " times in "
+      << s_scratch_resize_seconds << " s" << std::endl;
 
     if (detail) {
       for (int i = 0; i < s_thread_pool_size[0]; ++i) {
@@ -471,7 +499,7 @@ void ThreadsInternal::print_configuration(std::ostream &s, const bool detail) {
 
 int ThreadsInternal::is_initialized() { return nullptr != s_threads_exec[0]; }
 
-void ThreadsInternal::initialize(int thread_count_arg) {
+void ThreadsInternal::initialize(int thread_count_arg, int scratch_reserve) {
   unsigned thread_count = thread_count_arg == -1 ? 0 : thread_count_arg;
 
   const bool is_initialized = 0 != s_thread_pool_size[0];
@@ -573,8 +601,11 @@ void ThreadsInternal::initialize(int thread_count_arg) {
           s_threads_process.m_pool_rank, s_threads_process.m_pool_size);
       s_threads_pid[s_threads_process.m_pool_rank] = std::this_thread::get_id();
 
-      // Initial allocations:
-      ThreadsInternal::resize_scratch(1024, 1024);
+      // Initial allocations, the thread scratch also holds the team reduce
+      // buffer in front of the team and thread scratch of team kernels
+      ThreadsInternal::resize_scratch(
+          1024, std::max(1024, ThreadsExecTeamMember::team_reduce_size() +
+                                   scratch_reserve));
     } else {
       s_thread_pool_size[0] = 0;
       s_thread_pool_size[1] = 0;
@@ -116,7 +116,9 @@ class ThreadsInternal {
 
   static int is_initialized();
 
-  static void initialize(int thread_count);
+  // scratch_reserve: team and thread scratch bytes, summed over the members
+  // of a team, that a team kernel can request before the buffers grow
+  static void initialize(int thread_count, int scratch_reserve = 0);
 
   static void finalize();
 
@@ -558,7 +560,9 @@ inline int Threads::impl_is_initialized() {
 
 inline void Threads::impl_initialize(InitializationSettings const &settings) {
   Impl::ThreadsInternal::initialize(
-      settings.has_num_threads() ? settings.get_num_threads() : -1);
+      settings.has_num_threads() ? settings.get_num_threads() : -1,
+      settings.has_host_scratch_reserve() ? settings.get_host_scratch_reserve()
+                                          : 0);
 }
 
 inline void Threads::impl_finalize() { Impl::ThreadsInternal::finalize(); }
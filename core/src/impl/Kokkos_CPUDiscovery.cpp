@@ -20,9 +20,17 @@
 
 #include <impl/Kokkos_CPUDiscovery.hpp>
 
+#include <cstdint>
 #include <cstdlib>  // getenv
+#include <fstream>
 #include <string>
 
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#elif !defined(_WIN32)
+#include <unistd.h>
+#endif
+
 int Kokkos::Impl::mpi_ranks_per_node() {
   for (char const* env_var : {
            "OMPI_COMM_WORLD_LOCAL_SIZE",  // OpenMPI
@@ -56,3 +64,43 @@ int Kokkos::Impl::mpi_local_rank_on_node() {
 }
 
 bool Kokkos::Impl::mpi_detected() { return mpi_local_rank_on_node() != -1; }
+
+size_t Kokkos::Impl::cpu_last_level_cache_size() {
+  static const size_t size = [] {
+    size_t largest = 0;
+#if defined(__APPLE__)
+    for (char const* name : {"hw.l3cachesize", "hw.l2cachesize"}) {
+      int64_t value     = 0;
+      size_t value_size = sizeof(value);
+      if (sysctlbyname(name, &value, &value_size, nullptr, 0) == 0 &&
+          size_t(value) > largest) {
+        largest = value;
+      }
+    }
+#elif !defined(_WIN32)
+    // sysfs reports sizes such as "32K" or "36608K"
+    for (int index = 0; index < 8; ++index) {
+      std::ifstream file("/sys/devices/system/cpu/cpu0/cache/index" +
+                         std::to_string(index) + "/size");
+      size_t value = 0;
+      char unit    = 0;
+      if (!(file >> value)) break;
+      if (file >> unit) {
+        if (unit == 'K') value <<= 10;
+        if (unit == 'M') value <<= 20;
+      }
+      if (value > largest) largest = value;
+    }
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+    if (largest == 0) {
+      for (int name : {_SC_LEVEL3_CACHE_SIZE, _SC_LEVEL2_CACHE_SIZE}) {
+        const long value = sysconf(name);
+        if (value > 0 && size_t(value) > largest) largest = value;
+      }
+    }
+#endif
+#endif
+    return largest;
+  }();
+  return size;
+}
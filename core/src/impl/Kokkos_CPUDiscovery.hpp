@@ -13,6 +13,8 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
 //@HEADER
+#include <cstddef>
+
 namespace Kokkos {
 namespace Impl {
 
@@ -21,5 +23,8 @@ int mpi_local_rank_on_node();
 // returns true if MPI execution environment is detected, false otherwise.
 bool mpi_detected();
 
+// returns the size in bytes of the largest CPU cache, 0 if unknown.
+size_t cpu_last_level_cache_size();
+
 }  // namespace Impl
 }  // namespace Kokkos
@@ -154,6 +154,91 @@ struct concurrent_bitset {
     }
   }
 
+  /**\brief  Claim 'count' bits within the bitset bound with a single
+   *          update of the used count.
+   *
+   *  The claimed bits are written to 'bits[0..count)'.
+   *  Claiming is all or nothing.
+   *
+   *  Return : ( count , bit_count )
+   *
+   *  if success then
+   *    bit_count is the atomic-count of claimed after the claim
+   *  else the error codes are those of 'acquire_bounded_lg2'
+   */
+  KOKKOS_INLINE_FUNCTION static Kokkos::pair<int, int> acquire_bounded_lg2_n(
+      uint32_t volatile *const buffer, uint32_t const bit_bound_lg2,
+      uint32_t const count, uint32_t *const bits,
+      uint32_t bit = 0 /* optional hint */
+      ,
+      uint32_t const state_header = 0 /* optional header */
+      ) noexcept {
+    using type = Kokkos::pair<int, int>;
+
+    const uint32_t bit_bound  = 1 << bit_bound_lg2;
+    const uint32_t word_count = bit_bound >> bits_per_int_lg2;
+    const uint32_t word_mask =
+        bit_bound_lg2 < bits_per_int_lg2 ? (1u << bit_bound) - 1 : ~0u;
+
+    if ((max_bit_count_lg2 < bit_bound_lg2) ||
+        (state_header & ~state_header_mask) || (bit_bound < bit) ||
+        (0 == count) || (bit_bound < count)) {
+      return type(-3, -3);
+    }
+
+    const uint32_t state = (uint32_t)Kokkos::atomic_fetch_add(
+        reinterpret_cast<volatile int *>(buffer), int(count));
+
+    const uint32_t state_error = state_header != (state & state_header_mask);
+
+    const uint32_t state_bit_used = state & state_used_mask;
+
+    if (state_error || (bit_bound < state_bit_used + count)) {
+      Kokkos::atomic_fetch_add(reinterpret_cast<volatile int *>(buffer),
+                               -int(count));
+      return state_error ? type(-2, -2) : type(-1, -1);
+    }
+
+    // Do not update bits until count is visible:
+
+    Kokkos::memory_fence();
+
+    // At least 'count' zero bits are available somewhere,
+    // claim as many as possible from each word with one fetch_or.
+
+    uint32_t word = (bit & (bit_bound - 1)) >> bits_per_int_lg2;
+
+    for (uint32_t claimed = 0; claimed < count;) {
+      uint32_t avail = ~buffer[word + 1] & word_mask;
+
+      if (!avail) {
+        word = (word + 1) < word_count ? word + 1 : 0;
+        continue;
+      }
+
+      uint32_t want = 0;
+
+      for (uint32_t n = claimed; avail && n < count; ++n) {
+        const uint32_t low = avail & (~avail + 1);
+        want |= low;
+        avail ^= low;
+      }
+
+      // Bits lost to a racing claim are retried on the next pass
+
+      const uint32_t prev = Kokkos::atomic_fetch_or(buffer + word + 1, want);
+
+      for (uint32_t got = want & ~prev; got; got &= got - 1) {
+        bits[claimed++] = (word << bits_per_int_lg2) |
+                          uint32_t(Kokkos::Impl::bit_scan_forward(got));
+      }
+    }
+
+    Kokkos::memory_fence();
+
+    return type(int(count), int(state_bit_used + count));
+  }
+
   /**\brief  Claim any bit within the bitset bound.
    *
    *  Return : ( which_bit , bit_count )
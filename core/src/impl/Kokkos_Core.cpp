@@ -88,6 +88,7 @@ void combine(Kokkos::InitializationSettings& out,
   }                                       \
   static_assert(true, "no-op to require trailing semicolon")
   KOKKOS_IMPL_COMBINE_SETTING(num_threads);
+  KOKKOS_IMPL_COMBINE_SETTING(host_scratch_reserve);
   KOKKOS_IMPL_COMBINE_SETTING(map_device_id_by);
   KOKKOS_IMPL_COMBINE_SETTING(device_id);
   KOKKOS_IMPL_COMBINE_SETTING(disable_warnings);
@@ -160,6 +161,8 @@ unsigned get_process_id() {
 
 bool is_valid_num_threads(int x) { return x > 0; }
 
+bool is_valid_host_scratch_reserve(int x) { return x >= 0; }
+
 bool is_valid_device_id(int x) { return x >= 0; }
 
 bool is_valid_map_device_id_by(std::string const& x) {
@@ -836,6 +839,11 @@ Kokkos Core Options:
                                    left off, Kokkos uses heuristics
   --kokkos-num-threads=INT       : specify total number of threads to use for
                                    parallel regions on the host.
+  --kokkos-host-scratch-reserve=INT
+                                 : bytes of team scratch plus the thread
+                                   scratch of all team members that OpenMP
+                                   and Threads team kernels can request
+                                   without growing the host scratch buffers.
   --kokkos-device-id=INT         : specify device id to be used by Kokkos.
   --kokkos-map-device-id-by=(random|mpi_rank)
                                  : strategy to select device-id automatically from
@@ -883,6 +891,7 @@ void Kokkos::Impl::parse_command_line_arguments(
   combine(settings, tools_init_arguments);
 
   int num_threads;
+  int host_scratch_reserve;
   int device_id;
   std::string map_device_id_by;
   bool disable_warnings;
@@ -905,6 +914,17 @@ void Kokkos::Impl::parse_command_line_arguments(
       }
       settings.set_num_threads(num_threads);
       remove_flag = true;
+    } else if (check_arg_int(argv[iarg], "--kokkos-host-scratch-reserve",
+                             host_scratch_reserve)) {
+      if (!is_valid_host_scratch_reserve(host_scratch_reserve)) {
+        std::stringstream ss;
+        ss << "Error: command line argument '" << argv[iarg] << "' is invalid."
+           << " The scratch reservation must be greater than or equal to zero."
+           << " Raised by Kokkos::initialize().\n";
+        Kokkos::abort(ss.str().c_str());
+      }
+      settings.set_host_scratch_reserve(host_scratch_reserve);
+      remove_flag = true;
     } else if (check_arg_int(argv[iarg], "--kokkos-device-id", device_id)) {
       if (!is_valid_device_id(device_id)) {
         std::stringstream ss;
@@ -995,6 +1015,18 @@ void Kokkos::Impl::parse_environment_variables(
     }
     settings.set_num_threads(num_threads);
   }
+  int host_scratch_reserve;
+  if (check_env_int("KOKKOS_HOST_SCRATCH_RESERVE", host_scratch_reserve)) {
+    if (!is_valid_host_scratch_reserve(host_scratch_reserve)) {
+      std::stringstream ss;
+      ss << "Error: environment variable 'KOKKOS_HOST_SCRATCH_RESERVE="
+         << host_scratch_reserve << "' is invalid."
+         << " The scratch reservation must be greater than or equal to zero."
+         << " Raised by Kokkos::initialize().\n";
+      Kokkos::abort(ss.str().c_str());
+    }
+    settings.set_host_scratch_reserve(host_scratch_reserve);
+  }
   int device_id;
   if (check_env_int("KOKKOS_DEVICE_ID", device_id)) {
     if (!is_valid_device_id(device_id)) {
@@ -45,4 +45,25 @@ void team_policy_check_valid_storage_level_argument(int level) {
   }
 }
 
+void Impl::team_policy_check_work_offsets(
+    int league_size, const Kokkos::Experimental::WorkOffsets& offsets) {
+  if (offsets.size() != size_t(league_size) + 1) {
+    std::stringstream ss;
+    ss << "TeamPolicy::set_work_offsets: " << offsets.size()
+       << " work offsets given for a league of size " << league_size
+       << ", league_size + 1 are needed\n";
+    abort(ss.str().c_str());
+  }
+#ifdef KOKKOS_ENABLE_DEBUG
+  for (int i = 0; i < league_size; ++i) {
+    if (offsets(i + 1) < offsets(i)) {
+      std::stringstream ss;
+      ss << "TeamPolicy::set_work_offsets: the work offsets decrease at "
+         << "league rank " << i << "\n";
+      abort(ss.str().c_str());
+    }
+  }
+#endif
+}
+
 }  // namespace Kokkos
@@ -20,6 +20,134 @@
 
 #include "Kokkos_Core.hpp"
 #include "Kokkos_HostSpace_deepcopy.hpp"
+#include <impl/Kokkos_CPUDiscovery.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(KOKKOS_ARCH_AVX512XEON) && defined(__AVX512F__)
+#include <immintrin.h>
+#define KOKKOS_IMPL_HOSTSPACE_STREAM_WIDTH 64
+#elif (defined(KOKKOS_ARCH_AVX2) || defined(KOKKOS_ARCH_AVX)) && \
+    defined(__AVX__)
+#include <immintrin.h>
+#define KOKKOS_IMPL_HOSTSPACE_STREAM_WIDTH 32
+#endif
+
+namespace {
+
+// Copies below this size are done serially
+constexpr ptrdiff_t host_deep_copy_serial_limit = 10 * 8192;
+
+// Per-thread chunks start on page boundaries of the destination
+constexpr uintptr_t host_deep_copy_page_size = 4096;
+
+/*  Copies and fills at least as large as the last level cache would evict
+ *  everything else from it and, for regular stores, pay a read for
+ *  ownership of every destination line; they use non-temporal stores.
+ */
+size_t host_streaming_limit() {
+#ifdef KOKKOS_IMPL_HOSTSPACE_STREAM_WIDTH
+  static const size_t limit = [] {
+    const size_t cache_size = Kokkos::Impl::cpu_last_level_cache_size();
+    return cache_size > 0 ? cache_size : size_t(32) << 20;
+  }();
+  return limit;
+#else
+  return ~size_t(0);
+#endif
+}
+
+#ifdef KOKKOS_IMPL_HOSTSPACE_STREAM_WIDTH
+
+constexpr size_t stream_width = KOKKOS_IMPL_HOSTSPACE_STREAM_WIDTH;
+
+#if KOKKOS_IMPL_HOSTSPACE_STREAM_WIDTH == 64
+using stream_register = __m512i;
+inline stream_register stream_load(const char* p) {
+  return _mm512_loadu_si512(p);
+}
+inline void stream_store(char* p, stream_register v) {
+  _mm512_stream_si512(reinterpret_cast<stream_register*>(p), v);
+}
+#else
+using stream_register = __m256i;
+inline stream_register stream_load(const char* p) {
+  return _mm256_loadu_si256(reinterpret_cast<const stream_register*>(p));
+}
+inline void stream_store(char* p, stream_register v) {
+  _mm256_stream_si256(reinterpret_cast<stream_register*>(p), v);
+}
+#endif
+
+#endif
+
+// Copy [src, src + n) to dst, bypassing the cache if 'streaming'
+void host_copy_chunk(char* dst, const char* src, size_t n, bool streaming) {
+#ifdef KOKKOS_IMPL_HOSTSPACE_STREAM_WIDTH
+  if (streaming && n >= 2 * stream_width) {
+    const size_t head = (-reinterpret_cast<uintptr_t>(dst)) % stream_width;
+    std::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    n -= head;
+
+    const size_t body = n - n % stream_width;
+    for (size_t i = 0; i < body; i += stream_width) {
+      stream_store(dst + i, stream_load(src + i));
+    }
+    // Order the weakly ordered stores before the end of the kernel
+    _mm_sfence();
+
+    std::memcpy(dst + body, src + body, n - body);
+    return;
+  }
+#else
+  (void)streaming;
+#endif
+  std::memcpy(dst, src, n);
+}
+
+#ifdef KOKKOS_IMPL_HOSTSPACE_STREAM_WIDTH
+// Fill [dst, dst + n) bypassing the cache.  'pattern' holds 2 * stream_width
+// bytes repeating the fill value from the byte at offset 0 of the View.
+void host_fill_chunk(char* dst, size_t offset, size_t n, const char* pattern,
+                     size_t pattern_size) {
+  const size_t head =
+      std::min(n, (-reinterpret_cast<uintptr_t>(dst)) % stream_width);
+  for (size_t i = 0; i < head; ++i) {
+    dst[i] = pattern[(offset + i) % pattern_size];
+  }
+  dst += head;
+  offset += head;
+  n -= head;
+
+  const size_t body = n - n % stream_width;
+  const stream_register value =
+      stream_load(pattern + offset % pattern_size);
+  for (size_t i = 0; i < body; i += stream_width) {
+    stream_store(dst + i, value);
+  }
+  _mm_sfence();
+
+  for (size_t i = body; i < n; ++i) {
+    dst[i] = pattern[(offset + i) % pattern_size];
+  }
+}
+#endif
+
+// Begin of the i-th of 'nchunk' page aligned chunks of [dst, dst + n)
+size_t host_chunk_begin(const void* dst, size_t n, int nchunk, int i) {
+  if (i == 0) return 0;
+  if (i == nchunk) return n;
+  const uintptr_t base = reinterpret_cast<uintptr_t>(dst);
+  const uintptr_t split =
+      (base + (n / nchunk) * i + host_deep_copy_page_size - 1) &
+      ~(host_deep_copy_page_size - 1);
+  return std::min<size_t>(n, split - base);
+}
+
+}  // namespace
 
 namespace Kokkos {
 
@@ -46,100 +174,83 @@ void hostspace_parallel_deepcopy_async(void* dst, const void* src,
 template <typename ExecutionSpace>
 void hostspace_parallel_deepcopy_async(const ExecutionSpace& exec, void* dst,
                                        const void* src, ptrdiff_t n) {
-  using policy_t = Kokkos::RangePolicy<ExecutionSpace>;
+  if (n <= 0) return;
+
+  const bool streaming = size_t(n) >= host_streaming_limit();
 
   // If the asynchronous HPX backend is enabled, do *not* copy anything
   // synchronously. The deep copy must be correctly sequenced with respect to
-  // other kernels submitted to the same instance, so we only use the fallback
+  // other kernels submitted to the same instance, so we only use the
   // parallel_for version in this case.
 #if !(defined(KOKKOS_ENABLE_HPX) && \
       defined(KOKKOS_ENABLE_IMPL_HPX_ASYNC_DISPATCH))
-  constexpr int host_deep_copy_serial_limit = 10 * 8192;
   if ((n < host_deep_copy_serial_limit) || (exec.concurrency() == 1)) {
-    if (0 < n) std::memcpy(dst, src, n);
+    host_copy_chunk(static_cast<char*>(dst), static_cast<const char*>(src), n,
+                    streaming);
     return;
   }
+#endif
 
-  // Both src and dst are aligned the same way with respect to 8 byte words
-  if (reinterpret_cast<ptrdiff_t>(src) % 8 ==
-      reinterpret_cast<ptrdiff_t>(dst) % 8) {
-    char* dst_c       = reinterpret_cast<char*>(dst);
-    const char* src_c = reinterpret_cast<const char*>(src);
-    int count         = 0;
-    // get initial bytes copied
-    while (reinterpret_cast<ptrdiff_t>(dst_c) % 8 != 0) {
-      *dst_c = *src_c;
-      dst_c++;
-      src_c++;
-      count++;
-    }
+  // One chunk per thread, each starting on a page of the destination so that
+  // no two threads write to the same page
+  char* const dst_c       = static_cast<char*>(dst);
+  const char* const src_c = static_cast<const char*>(src);
+  const int nchunk        = exec.concurrency();
+  Kokkos::parallel_for(
+      "Kokkos::Impl::host_space_deepcopy",
+      Kokkos::RangePolicy<ExecutionSpace>(exec, 0, nchunk),
+      [=](const int i) {
+        const size_t begin = host_chunk_begin(dst, n, nchunk, i);
+        const size_t end   = host_chunk_begin(dst, n, nchunk, i + 1);
+        host_copy_chunk(dst_c + begin, src_c + begin, end - begin, streaming);
+      });
+}
 
-    // copy the bulk of the data
-    double* dst_p       = reinterpret_cast<double*>(dst_c);
-    const double* src_p = reinterpret_cast<const double*>(src_c);
-    Kokkos::parallel_for("Kokkos::Impl::host_space_deepcopy_double",
-                         policy_t(exec, 0, (n - count) / 8),
-                         [=](const ptrdiff_t i) { dst_p[i] = src_p[i]; });
-
-    // get final data copied
-    dst_c += ((n - count) / 8) * 8;
-    src_c += ((n - count) / 8) * 8;
-    char* dst_end = reinterpret_cast<char*>(dst) + n;
-    while (dst_c != dst_end) {
-      *dst_c = *src_c;
-      dst_c++;
-      src_c++;
-    }
-    return;
+template <typename ExecutionSpace>
+bool hostspace_parallel_fill_async(const ExecutionSpace& exec, void* dst,
+                                   const void* value, size_t value_size,
+                                   size_t n) {
+#ifdef KOKKOS_IMPL_HOSTSPACE_STREAM_WIDTH
+  // The value must repeat within a vector register
+  if (n < host_streaming_limit() || value_size == 0 ||
+      value_size > stream_width || stream_width % value_size != 0) {
+    return false;
   }
 
-  // Both src and dst are aligned the same way with respect to 4 byte words
-  if (reinterpret_cast<ptrdiff_t>(src) % 4 ==
-      reinterpret_cast<ptrdiff_t>(dst) % 4) {
-    char* dst_c       = reinterpret_cast<char*>(dst);
-    const char* src_c = reinterpret_cast<const char*>(src);
-    int count         = 0;
-    // get initial bytes copied
-    while (reinterpret_cast<ptrdiff_t>(dst_c) % 4 != 0) {
-      *dst_c = *src_c;
-      dst_c++;
-      src_c++;
-      count++;
-    }
-
-    // copy the bulk of the data
-    int32_t* dst_p       = reinterpret_cast<int32_t*>(dst_c);
-    const int32_t* src_p = reinterpret_cast<const int32_t*>(src_c);
-    Kokkos::parallel_for("Kokkos::Impl::host_space_deepcopy_int",
-                         policy_t(exec, 0, (n - count) / 4),
-                         [=](const ptrdiff_t i) { dst_p[i] = src_p[i]; });
-
-    // get final data copied
-    dst_c += ((n - count) / 4) * 4;
-    src_c += ((n - count) / 4) * 4;
-    char* dst_end = reinterpret_cast<char*>(dst) + n;
-    while (dst_c != dst_end) {
-      *dst_c = *src_c;
-      dst_c++;
-      src_c++;
-    }
-    return;
+  struct Pattern {
+    char bytes[2 * stream_width];
+  } pattern;
+  for (size_t i = 0; i < sizeof(pattern.bytes); ++i) {
+    pattern.bytes[i] = static_cast<const char*>(value)[i % value_size];
   }
-#endif
 
-  // Src and dst are not aligned the same way, we can only to byte wise copy.
-  {
-    char* dst_p       = reinterpret_cast<char*>(dst);
-    const char* src_p = reinterpret_cast<const char*>(src);
-    Kokkos::parallel_for("Kokkos::Impl::host_space_deepcopy_char",
-                         policy_t(exec, 0, n),
-                         [=](const ptrdiff_t i) { dst_p[i] = src_p[i]; });
-  }
+  char* const dst_c = static_cast<char*>(dst);
+  const int nchunk  = exec.concurrency();
+  Kokkos::parallel_for(
+      "Kokkos::Impl::host_space_fill",
+      Kokkos::RangePolicy<ExecutionSpace>(exec, 0, nchunk),
+      [=](const int i) {
+        const size_t begin = host_chunk_begin(dst, n, nchunk, i);
+        const size_t end   = host_chunk_begin(dst, n, nchunk, i + 1);
+        host_fill_chunk(dst_c + begin, begin, end - begin, pattern.bytes,
+                        value_size);
+      });
+  return true;
+#else
+  (void)exec;
+  (void)dst;
+  (void)value;
+  (void)value_size;
+  (void)n;
+  return false;
+#endif
 }
 
 // Explicit instantiation
 template void hostspace_parallel_deepcopy_async<DefaultHostExecutionSpace>(
     const DefaultHostExecutionSpace&, void*, const void*, ptrdiff_t);
+template bool hostspace_parallel_fill_async<DefaultHostExecutionSpace>(
+    const DefaultHostExecutionSpace&, void*, const void*, size_t, size_t);
 
 #if defined(KOKKOS_ENABLE_SERIAL) &&                                    \
     (defined(KOKKOS_ENABLE_OPENMP) || defined(KOKKOS_ENABLE_THREADS) || \
@@ -148,7 +259,11 @@ template void hostspace_parallel_deepcopy_async<DefaultHostExecutionSpace>(
 // backend are enabled
 template void hostspace_parallel_deepcopy_async<Kokkos::Serial>(
     const Kokkos::Serial&, void*, const void*, ptrdiff_t);
+template bool hostspace_parallel_fill_async<Kokkos::Serial>(
+    const Kokkos::Serial&, void*, const void*, size_t, size_t);
 #endif
 }  // namespace Impl
 
 }  // namespace Kokkos
+
+#undef KOKKOS_IMPL_HOSTSPACE_STREAM_WIDTH
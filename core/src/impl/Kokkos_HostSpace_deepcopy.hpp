@@ -31,6 +31,14 @@ void hostspace_parallel_deepcopy_async(void* dst, const void* src, ptrdiff_t n);
 template <typename ExecutionSpace>
 void hostspace_parallel_deepcopy_async(const ExecutionSpace& exec, void* dst,
                                        const void* src, ptrdiff_t n);
+
+// Fill n bytes at dst with copies of the value_size bytes at value if the
+// fill is large enough to bypass the cache.  Returns false, without touching
+// dst, otherwise.
+template <typename ExecutionSpace>
+bool hostspace_parallel_fill_async(const ExecutionSpace& exec, void* dst,
+                                   const void* value, size_t value_size,
+                                   size_t n);
 }  // namespace Impl
 
 }  // namespace Kokkos
@@ -369,6 +369,46 @@ class HostThreadTeamData {
                        : 0;
   }
 
+  //----------------------------------------
+  // Set the initial work partitioning of [ 0 .. offsets.size() - 1 ) among
+  // the teams with granularity of one: the work offsets(0) .. offsets(last)
+  // is cut into equal shares and each team takes the indices whose work
+  // starts in its share.
+
+  void set_work_partition(
+      Kokkos::Experimental::WorkOffsets const& offsets) noexcept {
+    int const length    = offsets.size() - 1;
+    int64_t const base  = offsets(0);
+    int64_t const total = offsets(length) - base;
+
+    auto const team_begin = [&](int const team) {
+      if (team == 0) return 0;
+      if (team == m_league_size) return length;
+      int64_t const target = base + (total / m_league_size) * team +
+                             (total % m_league_size) * team / m_league_size;
+      int first = 0;
+      int last  = length;
+      while (first < last) {
+        int const mid = first + (last - first) / 2;
+        if (offsets(mid) < target) {
+          first = mid + 1;
+        } else {
+          last = mid;
+        }
+      }
+      return first;
+    };
+
+    m_work_end          = length;
+    m_work_chunk        = 1;
+    m_work_range.first  = team_begin(m_league_rank);
+    m_work_range.second = team_begin(m_league_rank + 1);
+
+    m_steal_rank = m_team_base + m_team_alloc + m_team_size <= m_pool_size
+                       ? m_team_base + m_team_alloc
+                       : 0;
+  }
+
   std::pair<int64_t, int64_t> get_work_partition() noexcept {
     int64_t first  = m_work_range.first;
     int64_t second = m_work_range.second;
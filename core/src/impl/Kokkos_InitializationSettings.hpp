@@ -60,6 +60,7 @@ class InitializationSettings {
 
  public:
   KOKKOS_IMPL_DECLARE(int, num_threads);
+  KOKKOS_IMPL_DECLARE(int, host_scratch_reserve);
   KOKKOS_IMPL_DECLARE(int, device_id);
   KOKKOS_IMPL_DECLARE(std::string, map_device_id_by);
   KOKKOS_IMPL_DECLARE_DEPRECATED(int, num_devices);
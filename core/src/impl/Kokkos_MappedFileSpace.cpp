@@ -0,0 +1,255 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <Kokkos_Macros.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_MappedFileSpace.hpp>
+#include <impl/Kokkos_Error.hpp>
+#include <impl/Kokkos_Tools.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace {
+
+/*  An allocation is laid out as
+ *    [ anonymous pages holding the header | file pages from offset 0 ]
+ *  so that the SharedAllocationHeader written in front of a View's data
+ *  does not land in the file.  The header occupies the bytes
+ *  'alloc_size - logical_size' immediately before the file pages.
+ */
+struct MappedFileLayout {
+  size_t data_size;
+  size_t header_size;
+  size_t prefix_size;
+  size_t map_size;
+
+  MappedFileLayout(size_t alloc_size, size_t logical_size) {
+#ifndef _WIN32
+    static const size_t page_size = sysconf(_SC_PAGESIZE);
+#else
+    static const size_t page_size = 4096;
+#endif
+    const size_t page_mask = page_size - 1;
+
+    data_size   = logical_size > 0 ? logical_size : alloc_size;
+    header_size = alloc_size - data_size;
+    prefix_size = (header_size + page_mask) & ~page_mask;
+    map_size    = prefix_size + ((data_size + page_mask) & ~page_mask);
+  }
+};
+
+[[noreturn]] void throw_mapped_file_error(std::string const& path,
+                                          char const* what) {
+  Kokkos::Impl::throw_runtime_exception(
+      std::string("Kokkos::Experimental::MappedFileSpace: ") + what + " '" +
+      path + "': " + std::strerror(errno));
+}
+
+}  // namespace
+
+namespace Kokkos {
+namespace Experimental {
+
+void* MappedFileSpace::allocate(const size_t arg_alloc_size) const {
+  return allocate("[unlabeled]", arg_alloc_size);
+}
+void* MappedFileSpace::allocate(const char* arg_label,
+                                const size_t arg_alloc_size,
+                                const size_t arg_logical_size) const {
+  return impl_allocate(arg_label, arg_alloc_size, arg_logical_size);
+}
+
+#ifndef _WIN32
+
+void* MappedFileSpace::impl_allocate(
+    const char* arg_label, const size_t arg_alloc_size,
+    const size_t arg_logical_size,
+    const Kokkos::Tools::SpaceHandle arg_handle) const {
+  if (0 == arg_alloc_size) return nullptr;
+
+  const MappedFileLayout layout(arg_alloc_size, arg_logical_size);
+
+  // Reserve the whole range, the file is mapped over the data pages.
+
+  char* const base = static_cast<char*>(
+      mmap(nullptr, layout.map_size, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+
+  if (MAP_FAILED == static_cast<void*>(base)) {
+    Kokkos::Impl::throw_bad_alloc(name(), arg_alloc_size, arg_label);
+  }
+
+  char* const data = base + layout.prefix_size;
+
+  if (!m_path.empty() && layout.data_size) {
+    const bool read_only =
+        m_mode == Mode::read_only || m_mode == Mode::copy_on_write;
+
+    const int open_flags = read_only                ? O_RDONLY
+                           : m_mode == Mode::create ? O_RDWR | O_CREAT | O_TRUNC
+                                                    : O_RDWR;
+
+    const int fd = open(m_path.c_str(), open_flags, 0644);
+
+    if (fd < 0) {
+      munmap(base, layout.map_size);
+      throw_mapped_file_error(m_path, "cannot open");
+    }
+
+    struct stat file_stat;
+
+    if (fstat(fd, &file_stat) < 0) {
+      close(fd);
+      munmap(base, layout.map_size);
+      throw_mapped_file_error(m_path, "cannot stat");
+    }
+
+    if (size_t(file_stat.st_size) < layout.data_size) {
+      if (read_only) {
+        close(fd);
+        munmap(base, layout.map_size);
+        errno = EINVAL;
+        throw_mapped_file_error(m_path, "allocation is larger than the file");
+      }
+      if (ftruncate(fd, layout.data_size) < 0) {
+        close(fd);
+        munmap(base, layout.map_size);
+        throw_mapped_file_error(m_path, "cannot resize");
+      }
+    }
+
+    const int prot = m_mode == Mode::read_only ? PROT_READ
+                                                : PROT_READ | PROT_WRITE;
+
+    int flags = MAP_FIXED |
+                (m_mode == Mode::copy_on_write ? MAP_PRIVATE : MAP_SHARED);
+#ifdef MAP_POPULATE
+    if (m_populate) flags |= MAP_POPULATE;
+#endif
+
+    void* const mapped = mmap(data, layout.data_size, prot, flags, fd, 0);
+
+    // The mapping keeps its own reference to the file
+    close(fd);
+
+    if (MAP_FAILED == mapped) {
+      munmap(base, layout.map_size);
+      throw_mapped_file_error(m_path, "cannot map");
+    }
+  }
+
+  int advice = MADV_NORMAL;
+
+  switch (m_advice) {
+    case Advice::normal: advice = MADV_NORMAL; break;
+    case Advice::sequential: advice = MADV_SEQUENTIAL; break;
+    case Advice::random: advice = MADV_RANDOM; break;
+    case Advice::will_need: advice = MADV_WILLNEED; break;
+  }
+
+  // Advice is only a hint, failure is not an error
+  if (MADV_NORMAL != advice && layout.data_size) {
+    (void)madvise(data, layout.data_size, advice);
+  }
+
+  void* const ptr = data - layout.header_size;
+
+  if (Kokkos::Profiling::profileLibraryLoaded()) {
+    Kokkos::Profiling::allocateData(arg_handle, arg_label, ptr,
+                                    layout.data_size);
+  }
+  return ptr;
+}
+
+void MappedFileSpace::impl_deallocate(
+    const char* arg_label, void* const arg_alloc_ptr,
+    const size_t arg_alloc_size, const size_t arg_logical_size,
+    const Kokkos::Tools::SpaceHandle arg_handle) const {
+  if (arg_alloc_ptr) {
+    const MappedFileLayout layout(arg_alloc_size, arg_logical_size);
+
+    if (Kokkos::Profiling::profileLibraryLoaded()) {
+      Kokkos::Profiling::deallocateData(arg_handle, arg_label, arg_alloc_ptr,
+                                        layout.data_size);
+    }
+
+    char* const data = static_cast<char*>(arg_alloc_ptr) + layout.header_size;
+    char* const base = data - layout.prefix_size;
+
+    if (!m_path.empty() &&
+        (m_mode == Mode::read_write || m_mode == Mode::create)) {
+      if (msync(data, layout.data_size, MS_SYNC) < 0) {
+        Kokkos::Impl::host_abort(
+            "Kokkos::Experimental::MappedFileSpace: msync failed");
+      }
+    }
+
+    munmap(base, layout.map_size);
+  }
+}
+
+#else
+
+void* MappedFileSpace::impl_allocate(const char*, const size_t, const size_t,
+                                     const Kokkos::Tools::SpaceHandle) const {
+  Kokkos::Impl::throw_runtime_exception(
+      "Kokkos::Experimental::MappedFileSpace is not supported on Windows");
+}
+
+void MappedFileSpace::impl_deallocate(const char*, void* const, const size_t,
+                                      const size_t,
+                                      const Kokkos::Tools::SpaceHandle) const {}
+
+#endif
+
+void MappedFileSpace::deallocate(void* const arg_alloc_ptr,
+                                 const size_t arg_alloc_size) const {
+  deallocate("[unlabeled]", arg_alloc_ptr, arg_alloc_size);
+}
+
+void MappedFileSpace::deallocate(const char* arg_label,
+                                 void* const arg_alloc_ptr,
+                                 const size_t arg_alloc_size,
+                                 const size_t arg_logical_size) const {
+  if (arg_alloc_ptr)
+    Kokkos::fence("MappedFileSpace::impl_deallocate before unmap");
+  impl_deallocate(arg_label, arg_alloc_ptr, arg_alloc_size, arg_logical_size);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#include <impl/Kokkos_SharedAlloc_timpl.hpp>
+
+KOKKOS_IMPL_SHARED_ALLOCATION_RECORD_EXPLICIT_INSTANTIATION(
+    Kokkos::Experimental::MappedFileSpace);
@@ -0,0 +1,351 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#include <Kokkos_Macros.hpp>
+static_assert(false,
+              "Including non-public Kokkos header files is not allowed.");
+#endif
+#ifndef KOKKOS_VIEWCOPYTRANSPOSE_HPP
+#define KOKKOS_VIEWCOPYTRANSPOSE_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <Kokkos_Parallel.hpp>
+#include <Kokkos_HostSpace.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX__) && \
+    (defined(KOKKOS_ARCH_AVX2) || defined(KOKKOS_ARCH_AVX512XEON))
+#define KOKKOS_IMPL_VIEWCOPY_TRANSPOSE_AVX
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__) && \
+    defined(KOKKOS_ARCH_ARM_NEON)
+#define KOKKOS_IMPL_VIEWCOPY_TRANSPOSE_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+/*  Register transposes of a block x block tile of 'Size' byte values:
+ *    dst[c * dst_ld + r] = src[r * src_ld + c]
+ *  The generic version has block == 1 and is never called.
+ */
+template <size_t Size>
+struct ViewCopyTransposeBlock {
+  static constexpr int block = 1;
+  static void apply(void*, int64_t, const void*, int64_t) {}
+};
+
+#if defined(KOKKOS_IMPL_VIEWCOPY_TRANSPOSE_AVX)
+
+template <>
+struct ViewCopyTransposeBlock<4> {
+  static constexpr int block = 8;
+  static void apply(void* dst_, int64_t dst_ld, const void* src_,
+                    int64_t src_ld) {
+    float* const dst       = static_cast<float*>(dst_);
+    const float* const src = static_cast<const float*>(src_);
+
+    __m256 r0 = _mm256_loadu_ps(src + 0 * src_ld);
+    __m256 r1 = _mm256_loadu_ps(src + 1 * src_ld);
+    __m256 r2 = _mm256_loadu_ps(src + 2 * src_ld);
+    __m256 r3 = _mm256_loadu_ps(src + 3 * src_ld);
+    __m256 r4 = _mm256_loadu_ps(src + 4 * src_ld);
+    __m256 r5 = _mm256_loadu_ps(src + 5 * src_ld);
+    __m256 r6 = _mm256_loadu_ps(src + 6 * src_ld);
+    __m256 r7 = _mm256_loadu_ps(src + 7 * src_ld);
+
+    const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    const __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+    const __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+    const __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+    const __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+
+    const __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+    r0 = _mm256_permute2f128_ps(s0, s4, 0x20);
+    r1 = _mm256_permute2f128_ps(s1, s5, 0x20);
+    r2 = _mm256_permute2f128_ps(s2, s6, 0x20);
+    r3 = _mm256_permute2f128_ps(s3, s7, 0x20);
+    r4 = _mm256_permute2f128_ps(s0, s4, 0x31);
+    r5 = _mm256_permute2f128_ps(s1, s5, 0x31);
+    r6 = _mm256_permute2f128_ps(s2, s6, 0x31);
+    r7 = _mm256_permute2f128_ps(s3, s7, 0x31);
+
+    _mm256_storeu_ps(dst + 0 * dst_ld, r0);
+    _mm256_storeu_ps(dst + 1 * dst_ld, r1);
+    _mm256_storeu_ps(dst + 2 * dst_ld, r2);
+    _mm256_storeu_ps(dst + 3 * dst_ld, r3);
+    _mm256_storeu_ps(dst + 4 * dst_ld, r4);
+    _mm256_storeu_ps(dst + 5 * dst_ld, r5);
+    _mm256_storeu_ps(dst + 6 * dst_ld, r6);
+    _mm256_storeu_ps(dst + 7 * dst_ld, r7);
+  }
+};
+
+template <>
+struct ViewCopyTransposeBlock<8> {
+  static constexpr int block = 4;
+  static void apply(void* dst_, int64_t dst_ld, const void* src_,
+                    int64_t src_ld) {
+    double* const dst       = static_cast<double*>(dst_);
+    const double* const src = static_cast<const double*>(src_);
+
+    const __m256d r0 = _mm256_loadu_pd(src + 0 * src_ld);
+    const __m256d r1 = _mm256_loadu_pd(src + 1 * src_ld);
+    const __m256d r2 = _mm256_loadu_pd(src + 2 * src_ld);
+    const __m256d r3 = _mm256_loadu_pd(src + 3 * src_ld);
+
+    const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+    _mm256_storeu_pd(dst + 0 * dst_ld, _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(dst + 1 * dst_ld, _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(dst + 2 * dst_ld, _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(dst + 3 * dst_ld, _mm256_permute2f128_pd(t1, t3, 0x31));
+  }
+};
+
+#elif defined(KOKKOS_IMPL_VIEWCOPY_TRANSPOSE_NEON)
+
+template <>
+struct ViewCopyTransposeBlock<4> {
+  static constexpr int block = 4;
+  static void apply(void* dst_, int64_t dst_ld, const void* src_,
+                    int64_t src_ld) {
+    uint32_t* const dst       = static_cast<uint32_t*>(dst_);
+    const uint32_t* const src = static_cast<const uint32_t*>(src_);
+
+    const uint32x4x2_t a =
+        vtrnq_u32(vld1q_u32(src + 0 * src_ld), vld1q_u32(src + 1 * src_ld));
+    const uint32x4x2_t b =
+        vtrnq_u32(vld1q_u32(src + 2 * src_ld), vld1q_u32(src + 3 * src_ld));
+
+    vst1q_u32(dst + 0 * dst_ld,
+              vcombine_u32(vget_low_u32(a.val[0]), vget_low_u32(b.val[0])));
+    vst1q_u32(dst + 1 * dst_ld,
+              vcombine_u32(vget_low_u32(a.val[1]), vget_low_u32(b.val[1])));
+    vst1q_u32(dst + 2 * dst_ld,
+              vcombine_u32(vget_high_u32(a.val[0]), vget_high_u32(b.val[0])));
+    vst1q_u32(dst + 3 * dst_ld,
+              vcombine_u32(vget_high_u32(a.val[1]), vget_high_u32(b.val[1])));
+  }
+};
+
+template <>
+struct ViewCopyTransposeBlock<8> {
+  static constexpr int block = 2;
+  static void apply(void* dst_, int64_t dst_ld, const void* src_,
+                    int64_t src_ld) {
+    uint64_t* const dst       = static_cast<uint64_t*>(dst_);
+    const uint64_t* const src = static_cast<const uint64_t*>(src_);
+
+    const uint64x2_t r0 = vld1q_u64(src + 0 * src_ld);
+    const uint64x2_t r1 = vld1q_u64(src + 1 * src_ld);
+
+    vst1q_u64(dst + 0 * dst_ld, vzip1q_u64(r0, r1));
+    vst1q_u64(dst + 1 * dst_ld, vzip2q_u64(r0, r1));
+  }
+};
+
+#endif
+
+/*  Host copy between Views whose unit stride dimensions differ, such as
+ *  LayoutLeft <-> LayoutRight.  Let p be the unit stride dimension of the
+ *  destination and q the one of the source.  For every index of the other
+ *  dimensions the (p, q) planes are copied tile by tile, so both Views are
+ *  streamed through cache lines instead of one of them being accessed with
+ *  a large stride.  Tiles of identical 4 or 8 byte types are transposed in
+ *  registers where SIMD is available.
+ */
+template <class DstValue, class SrcValue, class ExecSpace>
+struct ViewCopyTranspose {
+  using kernel_type = ViewCopyTransposeBlock<
+      (std::is_same_v<DstValue, SrcValue> &&
+       std::is_trivially_copyable_v<DstValue>)
+          ? sizeof(DstValue)
+          : 0>;
+
+  static constexpr int block = kernel_type::block;
+
+  // Tiles of 16 KiB for 4 byte values, a multiple of any block size
+  static constexpr int64_t tile = sizeof(DstValue) <= 4 ? 64 : 32;
+
+  DstValue* m_dst;
+  const SrcValue* m_src;
+  int64_t m_dst_ld;  // destination stride along q
+  int64_t m_src_ld;  // source stride along p
+  int64_t m_np;
+  int64_t m_nq;
+  int64_t m_ntile_p;
+  int64_t m_ntile_q;
+  int m_nbatch;
+  int64_t m_batch_extent[6];
+  int64_t m_dst_batch_stride[6];
+  int64_t m_src_batch_stride[6];
+
+  ViewCopyTranspose(const ExecSpace& space, DstValue* dst,
+                    const SrcValue* src, int rank, const int64_t* extents,
+                    const int64_t* dst_strides, const int64_t* src_strides,
+                    int p, int q)
+      : m_dst(dst),
+        m_src(src),
+        m_dst_ld(dst_strides[q]),
+        m_src_ld(src_strides[p]),
+        m_np(extents[p]),
+        m_nq(extents[q]),
+        m_ntile_p((extents[p] + tile - 1) / tile),
+        m_ntile_q((extents[q] + tile - 1) / tile),
+        m_nbatch(0) {
+    int64_t nwork = m_ntile_p * m_ntile_q;
+    for (int r = 0; r < rank; ++r) {
+      if (r == p || r == q) continue;
+      m_batch_extent[m_nbatch]     = extents[r];
+      m_dst_batch_stride[m_nbatch] = dst_strides[r];
+      m_src_batch_stride[m_nbatch] = src_strides[r];
+      nwork *= extents[r];
+      ++m_nbatch;
+    }
+    Kokkos::parallel_for(
+        "Kokkos::ViewCopy-Transpose",
+        Kokkos::RangePolicy<ExecSpace, Kokkos::IndexType<int64_t>>(space, 0,
+                                                                   nwork),
+        *this);
+  }
+
+  // dst[q * dst_ld + p] = src[p * src_ld + q] for p < np, q < nq
+  static void copy_scalar(DstValue* dst, int64_t dst_ld, const SrcValue* src,
+                          int64_t src_ld, int64_t np, int64_t nq) {
+    for (int64_t iq = 0; iq < nq; ++iq) {
+      for (int64_t ip = 0; ip < np; ++ip) {
+        dst[iq * dst_ld + ip] = static_cast<DstValue>(src[ip * src_ld + iq]);
+      }
+    }
+  }
+
+  void operator()(int64_t w) const {
+    const int64_t tq = w % m_ntile_q;
+    w /= m_ntile_q;
+    const int64_t tp = w % m_ntile_p;
+    w /= m_ntile_p;
+
+    DstValue* dst       = m_dst;
+    const SrcValue* src = m_src;
+    for (int b = 0; b < m_nbatch; ++b) {
+      const int64_t i = w % m_batch_extent[b];
+      w /= m_batch_extent[b];
+      dst += i * m_dst_batch_stride[b];
+      src += i * m_src_batch_stride[b];
+    }
+
+    const int64_t p0 = tp * tile;
+    const int64_t q0 = tq * tile;
+    const int64_t np = m_np - p0 < tile ? m_np - p0 : tile;
+    const int64_t nq = m_nq - q0 < tile ? m_nq - q0 : tile;
+
+    dst += q0 * m_dst_ld + p0;
+    src += p0 * m_src_ld + q0;
+
+    if constexpr (block > 1) {
+      const int64_t np_block = np - np % block;
+      const int64_t nq_block = nq - nq % block;
+      for (int64_t ip = 0; ip < np_block; ip += block) {
+        for (int64_t iq = 0; iq < nq_block; iq += block) {
+          kernel_type::apply(dst + iq * m_dst_ld + ip, m_dst_ld,
+                             src + ip * m_src_ld + iq, m_src_ld);
+        }
+      }
+      copy_scalar(dst + np_block, m_dst_ld, src + np_block * m_src_ld,
+                  m_src_ld, np - np_block, nq);
+      copy_scalar(dst + nq_block * m_dst_ld, m_dst_ld, src + nq_block,
+                  m_src_ld, np_block, nq - nq_block);
+    } else {
+      copy_scalar(dst, m_dst_ld, src, m_src_ld, np, nq);
+    }
+  }
+};
+
+/*  Use ViewCopyTranspose for a host copy if the destination and the
+ *  source have unit stride in different dimensions that are both long
+ *  enough for tiling to pay off.  Returns false if the copy is left to
+ *  ViewCopy.
+ */
+template <class ExecSpace, class DstType, class SrcType>
+bool view_copy_transpose(const ExecSpace& space, const DstType& dst,
+                         const SrcType& src) {
+  if constexpr (int(DstType::rank) < 2 ||
+                !Kokkos::SpaceAccessibility<ExecSpace,
+                                            Kokkos::HostSpace>::accessible ||
+                !Kokkos::SpaceAccessibility<
+                    ExecSpace, typename DstType::memory_space>::accessible ||
+                !Kokkos::SpaceAccessibility<
+                    ExecSpace, typename SrcType::memory_space>::accessible) {
+    return false;
+  } else {
+    constexpr int rank = DstType::rank;
+
+    int64_t extents[rank];
+    int64_t dst_strides[rank + 1];
+    int64_t src_strides[rank + 1];
+    dst.stride(dst_strides);
+    src.stride(src_strides);
+
+    int p = -1;
+    int q = -1;
+    for (int r = 0; r < rank; ++r) {
+      extents[r] = dst.extent(r);
+      if (extents[r] == 0) return false;
+      if (extents[r] > 1 && dst_strides[r] == 1) p = r;
+      if (extents[r] > 1 && src_strides[r] == 1) q = r;
+    }
+
+    constexpr int64_t min_extent = 16;
+
+    if (p < 0 || q < 0 || p == q || extents[p] < min_extent ||
+        extents[q] < min_extent) {
+      return false;
+    }
+
+    ViewCopyTranspose<typename DstType::value_type,
+                      typename SrcType::non_const_value_type, ExecSpace>(
+        space, dst.data(), src.data(), rank, extents, dst_strides,
+        src_strides, p, q);
+    return true;
+  }
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#undef KOKKOS_IMPL_VIEWCOPY_TRANSPOSE_AVX
+#undef KOKKOS_IMPL_VIEWCOPY_TRANSPOSE_NEON
+
+#endif  // KOKKOS_VIEWCOPYTRANSPOSE_HPP
@@ -0,0 +1,282 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <Kokkos_Macros.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ViewIO.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+namespace {
+
+// Alignment of buffers, offsets and lengths for O_DIRECT transfers
+constexpr size_t direct_io_alignment = 4096;
+
+// Size of the staging buffer used for O_DIRECT writes of unaligned data
+constexpr size_t direct_io_buffer_size = size_t(16) << 20;
+
+// Upper bound of a single read or write call
+constexpr size_t max_transfer_size = size_t(1) << 30;
+
+[[noreturn]] void throw_view_file_error(std::string const& path,
+                                        char const* what) {
+  Kokkos::Impl::throw_runtime_exception(
+      std::string("Kokkos::Experimental::") + what + " '" + path +
+      "': " + std::strerror(errno));
+}
+
+#ifndef _WIN32
+
+// Write all of [data, data + size) at 'offset', return false on error
+bool write_all(int fd, const char* data, size_t size, off_t offset) {
+  while (size > 0) {
+    const ssize_t n = pwrite(fd, data, std::min(size, max_transfer_size),
+                             offset);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    data += n;
+    size -= n;
+    offset += n;
+  }
+  return true;
+}
+
+// Read all of [data, data + size) from 'offset', return false on error or
+// if the file ends early
+bool read_all(int fd, char* data, size_t size, off_t offset) {
+  while (size > 0) {
+    const ssize_t n =
+        pread(fd, data, std::min(size, max_transfer_size), offset);
+    if (n <= 0) {
+      if (n < 0 && errno == EINTR) continue;
+      if (n == 0) errno = EIO;
+      return false;
+    }
+    data += n;
+    size -= n;
+    offset += n;
+  }
+  return true;
+}
+
+struct AlignedBuffer {
+  char* ptr;
+  explicit AlignedBuffer(size_t size)
+      : ptr(static_cast<char*>(std::aligned_alloc(direct_io_alignment, size))) {
+    if (!ptr) Kokkos::Impl::throw_bad_alloc("HostSpace", size, "ViewIO");
+  }
+  ~AlignedBuffer() { std::free(ptr); }
+  AlignedBuffer(AlignedBuffer const&)            = delete;
+  AlignedBuffer& operator=(AlignedBuffer const&) = delete;
+};
+
+#endif
+
+}  // namespace
+
+namespace Kokkos {
+namespace Impl {
+
+#ifndef _WIN32
+
+void view_file_write(const std::string& path, ViewFileHeader header,
+                     const void* data, bool direct_io) {
+  int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef O_DIRECT
+  if (direct_io) flags |= O_DIRECT;
+#else
+  direct_io = false;
+#endif
+
+  int fd = open(path.c_str(), flags, 0644);
+
+#ifdef O_DIRECT
+  // Some file systems, tmpfs for instance, refuse O_DIRECT
+  if (fd < 0 && direct_io && errno == EINVAL) {
+    direct_io = false;
+    fd        = open(path.c_str(), flags & ~O_DIRECT, 0644);
+  }
+#endif
+
+  if (fd < 0) throw_view_file_error(path, "write_view: cannot open");
+
+  // The header block is a multiple of the O_DIRECT alignment so the span
+  // starts at an aligned file offset.
+  static_assert(ViewFileHeader::data_offset % direct_io_alignment == 0);
+
+  bool ok = true;
+  {
+    AlignedBuffer block(ViewFileHeader::data_offset);
+    std::memset(block.ptr, 0, ViewFileHeader::data_offset);
+    std::memcpy(block.ptr, &header, sizeof(ViewFileHeader));
+    ok = write_all(fd, block.ptr, ViewFileHeader::data_offset, 0);
+  }
+
+  const char* src = static_cast<const char*>(data);
+  size_t size     = header.span_size;
+  off_t offset    = ViewFileHeader::data_offset;
+
+  if (ok && direct_io) {
+    // Stream the aligned part of the span, through a staging buffer
+    // if the View's data is not suitably aligned, then the tail below
+    // with O_DIRECT cleared.
+    const size_t aligned_size = size & ~(direct_io_alignment - 1);
+
+    if (reinterpret_cast<uintptr_t>(src) % direct_io_alignment == 0) {
+      ok = write_all(fd, src, aligned_size, offset);
+    } else if (aligned_size > 0) {
+      AlignedBuffer staging(std::min(aligned_size, direct_io_buffer_size));
+      for (size_t done = 0; ok && done < aligned_size;) {
+        const size_t n = std::min(aligned_size - done, direct_io_buffer_size);
+        std::memcpy(staging.ptr, src + done, n);
+        ok = write_all(fd, staging.ptr, n, offset + done);
+        done += n;
+      }
+    }
+
+    src += aligned_size;
+    size -= aligned_size;
+    offset += aligned_size;
+
+#ifdef O_DIRECT
+    if (ok && size > 0) {
+      ok = fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_DIRECT) == 0;
+    }
+#endif
+  }
+
+  if (ok) ok = write_all(fd, src, size, offset);
+
+  const int saved_errno = errno;
+  if (close(fd) < 0 || !ok) {
+    if (!ok) errno = saved_errno;
+    throw_view_file_error(path, "write_view: cannot write");
+  }
+}
+
+ViewFileHeader view_file_read_header(const std::string& path) {
+  const int fd = open(path.c_str(), O_RDONLY);
+
+  if (fd < 0) throw_view_file_error(path, "read_view: cannot open");
+
+  ViewFileHeader header;
+  const bool ok = read_all(fd, reinterpret_cast<char*>(&header),
+                           sizeof(ViewFileHeader), 0);
+  close(fd);
+
+  if (!ok) throw_view_file_error(path, "read_view: cannot read");
+
+  if (std::memcmp(header.magic, "KOKKOSVW", sizeof(header.magic)) != 0 ||
+      header.version != ViewFileHeader::version_value ||
+      header.rank > ARRAY_LAYOUT_MAX_RANK) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::read_view: '" + path +
+        "' was not written by Kokkos::Experimental::write_view");
+  }
+
+  header.value_type[sizeof(header.value_type) - 1] = 0;
+  header.label[sizeof(header.label) - 1]           = 0;
+
+  return header;
+}
+
+void view_file_read(const std::string& path, const ViewFileHeader& header,
+                    void* data) {
+  const int fd = open(path.c_str(), O_RDONLY);
+
+  if (fd < 0) throw_view_file_error(path, "read_view: cannot open");
+
+  // One page aligned chunk per thread, so that the threads of a later
+  // statically scheduled kernel over the View touch pages they read.
+  static const size_t page_size = sysconf(_SC_PAGESIZE);
+
+  const size_t size  = header.span_size;
+  const int nchunk   = std::max(DefaultHostExecutionSpace().concurrency(), 1);
+  const size_t chunk = std::max(
+      ((size + nchunk - 1) / nchunk + page_size - 1) & ~(page_size - 1),
+      page_size);
+  char* const dst = static_cast<char*>(data);
+  int failed      = 0;
+  int last_errno  = 0;
+
+  Kokkos::parallel_reduce(
+      "Kokkos::Experimental::read_view",
+      Kokkos::RangePolicy<DefaultHostExecutionSpace>(0, nchunk),
+      [&](int i, int& update) {
+        const size_t begin = std::min(size, i * chunk);
+        const size_t end   = std::min(size, begin + chunk);
+        if (!read_all(fd, dst + begin, end - begin,
+                      ViewFileHeader::data_offset + begin)) {
+          Kokkos::atomic_store(&last_errno, errno);
+          ++update;
+        }
+      },
+      failed);
+
+  close(fd);
+
+  if (failed) {
+    errno = last_errno;
+    throw_view_file_error(path, "read_view: cannot read");
+  }
+}
+
+#else
+
+void view_file_write(const std::string& path, ViewFileHeader, const void*,
+                     bool) {
+  Kokkos::Impl::throw_runtime_exception(
+      "Kokkos::Experimental::write_view: '" + path +
+      "': not supported on this platform");
+}
+
+ViewFileHeader view_file_read_header(const std::string& path) {
+  Kokkos::Impl::throw_runtime_exception(
+      "Kokkos::Experimental::read_view: '" + path +
+      "': not supported on this platform");
+}
+
+void view_file_read(const std::string& path, const ViewFileHeader&, void*) {
+  Kokkos::Impl::throw_runtime_exception(
+      "Kokkos::Experimental::read_view: '" + path +
+      "': not supported on this platform");
+}
+
+#endif
+
+}  // namespace Impl
+}  // namespace Kokkos
@@ -519,6 +519,43 @@ TEST(TEST_CATEGORY, atomics) {
 #endif
 }
 
+// many threads updating a handful of adjacent elements
+template <class T>
+struct ContendedAtomicAdd {
+  static constexpr int num_slots = 4;
+  Kokkos::View<T*, TEST_EXECSPACE> d_{"lbl", num_slots};
+
+  KOKKOS_FUNCTION void operator()(int i) const {
+    Kokkos::atomic_add(&d_(i % num_slots), T(1));
+  }
+
+  void check(int n) {
+    Kokkos::parallel_for(Kokkos::RangePolicy<TEST_EXECSPACE>(0, n), *this);
+    auto h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), d_);
+    for (int slot = 0; slot < num_slots; ++slot) {
+      ASSERT_EQ(h(slot), T(n / num_slots)) << slot;
+    }
+  }
+};
+
+TEST(TEST_CATEGORY, atomics_contended_composite_types) {
+  // FIXME_OPENMPTARGET
+  // FIXME_OPENACC: atomic operations on composite types are not supported.
+#if !defined(KOKKOS_ENABLE_OPENMPTARGET) && !defined(KOKKOS_ENABLE_OPENACC)
+// FIXME_SYCL Replace macro by SYCL_EXT_ONEAPI_DEVICE_GLOBAL or remove
+// condition alltogether when possible.
+#if defined(KOKKOS_ENABLE_SYCL) && \
+    !defined(KOKKOS_IMPL_SYCL_DEVICE_GLOBAL_SUPPORTED)
+  if (std::is_same_v<TEST_EXECSPACE, Kokkos::SYCL>) GTEST_SKIP();
+#endif
+  ContendedAtomicAdd<Kokkos::complex<double>>().check(40000);
+// WORKAROUND MSVC
+#ifndef _WIN32
+  ContendedAtomicAdd<SuperScalar<3>>().check(40000);
+#endif
+#endif
+}
+
 // see https://github.com/trilinos/Trilinos/pull/11506
 struct TpetraUseCase {
   template <class Scalar>
@@ -0,0 +1,143 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+using space_type = Kokkos::Experimental::MappedFileSpace;
+using Mode       = space_type::Mode;
+using Advice     = space_type::Advice;
+using exec_type  = space_type::execution_space;
+
+constexpr char file_name[] = "kokkos_mapped_file_space_test.bin";
+
+template <class ViewType>
+int count_mismatches(ViewType const& v, int offset) {
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      "check", Kokkos::RangePolicy<exec_type>(0, v.extent(0)),
+      KOKKOS_LAMBDA(int i, int& update) {
+        if (v(i) != 3 * i + offset) ++update;
+      },
+      errors);
+  return errors;
+}
+
+std::vector<int> read_file() {
+  std::ifstream in(file_name, std::ios::binary | std::ios::ate);
+  std::vector<int> values(in.tellg() / sizeof(int));
+  in.seekg(0);
+  in.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(int));
+  return values;
+}
+
+TEST(defaultdevicetype, mapped_file_space) {
+  const int n = 100000;
+
+  static_assert(Kokkos::is_memory_space_v<space_type>);
+  static_assert(
+      Kokkos::SpaceAccessibility<exec_type, space_type>::accessible);
+
+  // Write the file through a shared writable map
+  {
+    Kokkos::View<int*, space_type> v(
+        Kokkos::view_alloc(space_type(file_name, Mode::create), "create"), n);
+    Kokkos::parallel_for(
+        "fill", Kokkos::RangePolicy<exec_type>(0, n),
+        KOKKOS_LAMBDA(int i) { v(i) = 3 * i; });
+  }
+  {
+    std::vector<int> values = read_file();
+    ASSERT_EQ(int(values.size()), n);
+    for (int i = 0; i < n; ++i) ASSERT_EQ(values[i], 3 * i);
+  }
+
+  // Read it back lazily and eagerly
+  for (bool populate : {false, true}) {
+    Kokkos::View<int*, space_type> v(
+        Kokkos::view_alloc(
+            space_type(file_name, Mode::read_only, Advice::sequential,
+                       populate),
+            Kokkos::WithoutInitializing, "read"),
+        n);
+    ASSERT_EQ(count_mismatches(v, 0), 0);
+
+    Kokkos::View<int*, Kokkos::HostSpace> h("copy", n);
+    Kokkos::deep_copy(h, v);
+    ASSERT_EQ(count_mismatches(h, 0), 0);
+  }
+
+  // Private maps do not write through to the file
+  {
+    Kokkos::View<int*, space_type> v(
+        Kokkos::view_alloc(space_type(file_name, Mode::copy_on_write),
+                           Kokkos::WithoutInitializing, "private"),
+        n);
+    Kokkos::parallel_for(
+        "modify", Kokkos::RangePolicy<exec_type>(0, n),
+        KOKKOS_LAMBDA(int i) { v(i) += 1; });
+    ASSERT_EQ(count_mismatches(v, 1), 0);
+  }
+  {
+    std::vector<int> values = read_file();
+    for (int i = 0; i < n; ++i) ASSERT_EQ(values[i], 3 * i);
+  }
+
+  // Shared maps write through, and a larger allocation extends the file
+  {
+    Kokkos::View<int*, space_type> v(
+        Kokkos::view_alloc(space_type(file_name, Mode::read_write),
+                           Kokkos::WithoutInitializing, "update"),
+        2 * n);
+    Kokkos::parallel_for(
+        "extend", Kokkos::RangePolicy<exec_type>(n, 2 * n),
+        KOKKOS_LAMBDA(int i) { v(i) = 3 * i; });
+  }
+  {
+    std::vector<int> values = read_file();
+    ASSERT_EQ(int(values.size()), 2 * n);
+    for (int i = 0; i < 2 * n; ++i) ASSERT_EQ(values[i], 3 * i);
+  }
+
+  // A read-only map cannot be larger than the file
+  ASSERT_THROW(
+      (Kokkos::View<int*, space_type>(
+          Kokkos::view_alloc(space_type(file_name),
+                             Kokkos::WithoutInitializing, "too_large"),
+          4 * n)),
+      std::runtime_error);
+
+  std::remove(file_name);
+
+  ASSERT_THROW((Kokkos::View<int*, space_type>(
+                   Kokkos::view_alloc(space_type(file_name),
+                                      Kokkos::WithoutInitializing, "missing"),
+                   n)),
+               std::runtime_error);
+
+  // Without a file the space maps anonymous memory
+  {
+    Kokkos::View<int*, space_type> v("anonymous", n);
+    ASSERT_EQ(count_mismatches(v, 0), n - 1);
+  }
+}
+
+}  // namespace
@@ -440,6 +440,102 @@ void test_memory_pool_corners(const bool print_statistics,
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 
+template <class DeviceType>
+struct TestMemoryPoolThreadCache {
+  using ptrs_type = Kokkos::View<uintptr_t*, DeviceType>;
+  using pool_type = Kokkos::MemoryPool<DeviceType>;
+
+  pool_type pool;
+  ptrs_type ptrs;
+  uint32_t size;
+
+  using value_type = long;
+
+  struct TagAlloc {};
+  struct TagDealloc {};
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagAlloc, int i, long& err) const noexcept {
+    ptrs(i) = (uintptr_t)pool.allocate(size);
+    if (!ptrs(i) || (ptrs(i) & (size - 1))) ++err;
+  }
+
+  // Deallocate in reverse order so blocks cross between threads
+  KOKKOS_INLINE_FUNCTION
+  void operator()(TagDealloc, int i) const noexcept {
+    const int j = ptrs.extent(0) - 1 - i;
+    pool.deallocate((void*)ptrs(j), size);
+    ptrs(j) = 0;
+  }
+};
+
+template <class DeviceType>
+void test_memory_pool_thread_cache() {
+  using execution_space = typename DeviceType::execution_space;
+  using memory_space    = typename DeviceType::memory_space;
+  using functor_type    = TestMemoryPoolThreadCache<DeviceType>;
+  using pool_type       = typename functor_type::pool_type;
+  using TagAlloc        = typename functor_type::TagAlloc;
+  using TagDealloc      = typename functor_type::TagDealloc;
+
+  // Thread caches are only used by pools the host can access
+  if (!Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                  memory_space>::accessible) {
+    return;
+  }
+
+  // Four superblocks of 64 byte or 16k byte blocks
+  const size_t min_superblock_size = 1u << 16;
+  const size_t total_alloc_size    = 4 * min_superblock_size;
+
+  pool_type pool(memory_space(), total_alloc_size, 64, 1u << 14,
+                 min_superblock_size);
+
+  typename pool_type::usage_statistics stats;
+
+  for (int k = 0; k < 3; ++k) {
+    // Small blocks fill the pool through the per-thread caches
+    const int nsmall = 4000;
+    functor_type small{pool, typename functor_type::ptrs_type("ptrs", nsmall),
+                       64};
+    long err = 0;
+
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<execution_space, TagAlloc>(0, nsmall), small, err);
+    pool.get_usage_statistics(stats);
+    ASSERT_EQ(err, 0);
+    ASSERT_EQ(long(stats.consumed_blocks), nsmall);
+
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<execution_space, TagDealloc>(0, nsmall), small);
+    pool.get_usage_statistics(stats);
+    ASSERT_EQ(long(stats.consumed_blocks), 0);
+
+    // Every superblock is needed for the large blocks,
+    // so free blocks held in the caches must be returned
+    functor_type large{pool, typename functor_type::ptrs_type("ptrs", 16),
+                       1u << 14};
+
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<execution_space, TagAlloc>(0, 16), large, err);
+    pool.get_usage_statistics(stats);
+    ASSERT_EQ(err, 0);
+    ASSERT_EQ(long(stats.consumed_blocks), 16);
+
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<execution_space, TagDealloc>(0, 16), large);
+  }
+
+  pool.flush_thread_caches();
+  pool.get_usage_statistics(stats);
+  ASSERT_EQ(long(stats.consumed_blocks), 0);
+  ASSERT_EQ(long(stats.reserved_blocks), 0);
+  ASSERT_EQ(long(stats.consumed_superblocks), 0);
+}
+
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
 template <class DeviceType, class Enable = void>
 struct TestMemoryPoolHuge {
   enum : size_t { num_superblock = 0 };
@@ -527,11 +623,27 @@ void test_memory_pool_huge() {
 
 namespace Test {
 
+TEST(TEST_CATEGORY_DEATH, memory_pool_cached_double_free) {
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+
+  using pool_type = Kokkos::MemoryPool<Kokkos::DefaultHostExecutionSpace>;
+
+  pool_type pool(Kokkos::HostSpace(), 1u << 20);
+
+  void* const p = pool.allocate(64);
+  pool.deallocate(p, 64);
+
+  // The block is held in the calling thread's cache
+  ASSERT_DEATH(pool.deallocate(p, 64),
+               "Kokkos MemoryPool::deallocate given erroneous pointer");
+}
+
 TEST(TEST_CATEGORY, memory_pool) {
   TestMemoryPool::test_host_memory_pool_defaults<>();
   TestMemoryPool::test_host_memory_pool_stats<>();
   TestMemoryPool::test_memory_pool_v2<TEST_EXECSPACE>(false, false);
   TestMemoryPool::test_memory_pool_corners<TEST_EXECSPACE>(false, false);
+  TestMemoryPool::test_memory_pool_thread_cache<TEST_EXECSPACE>();
 #ifdef KOKKOS_ENABLE_LARGE_MEM_TESTS
   TestMemoryPool::test_memory_pool_huge<TEST_EXECSPACE>();
 #endif
@@ -153,6 +153,19 @@ TEST(defaultdevicetype, cmd_line_args_num_threads) {
   EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {"--foo=bar"});
 }
 
+TEST(defaultdevicetype, cmd_line_args_host_scratch_reserve) {
+  CmdLineArgsHelper cla = {{
+      "--kokkos-host-scratch-reserve=65536",
+      "--kokkos-num-threads=2",
+  }};
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_command_line_arguments(cla.argc(), cla.argv(), settings);
+  EXPECT_TRUE(settings.has_host_scratch_reserve());
+  EXPECT_EQ(settings.get_host_scratch_reserve(), 65536);
+  EXPECT_EQ(settings.get_num_threads(), 2);
+  EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
+}
+
 TEST(defaultdevicetype, cmd_line_args_device_id) {
   CmdLineArgsHelper cla = {{
       "--kokkos-device-id=3",
@@ -324,6 +337,17 @@ TEST(defaultdevicetype, env_vars_num_threads) {
   EXPECT_EQ(settings.get_num_threads(), 1);
 }
 
+TEST(defaultdevicetype, env_vars_host_scratch_reserve) {
+  EnvVarsHelper ev = {{
+      {"KOKKOS_HOST_SCRATCH_RESERVE", "1048576"},
+  }};
+  SKIP_IF_ENVIRONMENT_VARIABLE_ALREADY_SET(ev);
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_environment_variables(settings);
+  EXPECT_TRUE(settings.has_host_scratch_reserve());
+  EXPECT_EQ(settings.get_host_scratch_reserve(), 1048576);
+}
+
 TEST(defaultdevicetype, env_vars_device_id) {
   EnvVarsHelper ev = {{
       {"KOKKOS_DEVICE_ID", "33"},
@@ -42,6 +42,7 @@ struct TestTeamPolicyCTAD {
   [[maybe_unused]] static inline SomeExecutionSpace ses;
 
   [[maybe_unused]] static inline int i;
+  [[maybe_unused]] static inline Kokkos::Experimental::WorkOffsets wo;
 
   // Workaround for nvc++ (CUDA-11.7-NVHPC) ignoring [[maybe_unused]] on
   // ImplicitlyConvertibleToDefaultExecutionSpace::operator
@@ -50,7 +51,7 @@ struct TestTeamPolicyCTAD {
       notEs;
 
   // Workaround for HIP-ROCm-5.2 warning about was declared but never referenced
-  TestTeamPolicyCTAD() { maybe_unused(des, notEs, ses, i, notEsToDes); }
+  TestTeamPolicyCTAD() { maybe_unused(des, notEs, ses, i, wo, notEsToDes); }
 
   // Default construction deduces to TeamPolicy<>
   static_assert(
@@ -73,6 +74,11 @@ struct TestTeamPolicyCTAD {
   static_assert(
       std::is_same_v<Kokkos::TeamPolicy<>,
                      decltype(Kokkos::TeamPolicy(i, i, Kokkos::AUTO))>);
+  static_assert(std::is_same_v<Kokkos::TeamPolicy<>,
+                               decltype(Kokkos::TeamPolicy(i, i, wo))>);
+  static_assert(
+      std::is_same_v<Kokkos::TeamPolicy<>,
+                     decltype(Kokkos::TeamPolicy(i, Kokkos::AUTO, wo))>);
 
   // DefaultExecutionSpace deduces to TeamPolicy<>
 
@@ -92,6 +98,11 @@ struct TestTeamPolicyCTAD {
   static_assert(
       std::is_same_v<Kokkos::TeamPolicy<>,
                      decltype(Kokkos::TeamPolicy(des, i, i, Kokkos::AUTO))>);
+  static_assert(std::is_same_v<Kokkos::TeamPolicy<>,
+                               decltype(Kokkos::TeamPolicy(des, i, i, wo))>);
+  static_assert(
+      std::is_same_v<Kokkos::TeamPolicy<>,
+                     decltype(Kokkos::TeamPolicy(des, i, Kokkos::AUTO, wo))>);
 
   // Convertible to DefaultExecutionSpace deduces to TeamPolicy<>
 
@@ -130,6 +141,11 @@ struct TestTeamPolicyCTAD {
   static_assert(
       std::is_same_v<Kokkos::TeamPolicy<SomeExecutionSpace>,
                      decltype(Kokkos::TeamPolicy(ses, i, i, Kokkos::AUTO))>);
+  static_assert(std::is_same_v<Kokkos::TeamPolicy<SomeExecutionSpace>,
+                               decltype(Kokkos::TeamPolicy(ses, i, i, wo))>);
+  static_assert(
+      std::is_same_v<Kokkos::TeamPolicy<SomeExecutionSpace>,
+                     decltype(Kokkos::TeamPolicy(ses, i, Kokkos::AUTO, wo))>);
 };
 
 }  // namespace
@@ -0,0 +1,92 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+namespace {
+
+// Work offsets of a league whose ranks carry very different amounts of work:
+// a few heavy ranks, runs of empty ones and light ones in between.
+Kokkos::View<std::int64_t*, Kokkos::HostSpace> skewed_work_offsets(
+    int league_size) {
+  Kokkos::View<std::int64_t*, Kokkos::HostSpace> offsets("offsets",
+                                                         league_size + 1);
+  for (int i = 0; i < league_size; ++i) {
+    const std::int64_t work =
+        i % 97 == 0 ? 100000 : (i / 10) % 3 == 0 ? 0 : i % 5;
+    offsets(i + 1) = offsets(i) + work;
+  }
+  return offsets;
+}
+
+template <class ExecutionSpace, class Schedule>
+void test_team_work_offsets(int league_size) {
+  using policy_type = Kokkos::TeamPolicy<ExecutionSpace, Schedule>;
+  using member_type = typename policy_type::member_type;
+
+  const auto offsets = skewed_work_offsets(league_size);
+  const Kokkos::Experimental::WorkOffsets work_offsets(offsets);
+  ASSERT_EQ(work_offsets.size(), std::size_t(league_size) + 1);
+  ASSERT_EQ(work_offsets(league_size), offsets(league_size));
+
+  Kokkos::View<int*, ExecutionSpace> visits("visits", league_size);
+  Kokkos::parallel_for(
+      policy_type(league_size, Kokkos::AUTO, work_offsets),
+      KOKKOS_LAMBDA(const member_type& team) {
+        Kokkos::single(Kokkos::PerTeam(team), [&]() {
+          Kokkos::atomic_inc(&visits(team.league_rank()));
+        });
+      });
+  auto visits_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), visits);
+  for (int i = 0; i < league_size; ++i) {
+    ASSERT_EQ(visits_h(i), 1) << "league rank " << i;
+  }
+
+  std::int64_t sum = 0;
+  Kokkos::parallel_reduce(
+      policy_type(ExecutionSpace(), league_size, Kokkos::AUTO)
+          .set_work_offsets(work_offsets),
+      KOKKOS_LAMBDA(const member_type& team, std::int64_t& update) {
+        Kokkos::single(Kokkos::PerTeam(team),
+                       [&]() { update += team.league_rank() + 1; });
+      },
+      sum);
+  ASSERT_EQ(sum, std::int64_t(league_size) * (league_size + 1) / 2);
+}
+
+TEST(TEST_CATEGORY, team_work_offsets) {
+  for (int league_size : {0, 1, 7, 1000, 10007}) {
+    test_team_work_offsets<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Static>>(
+        league_size);
+    test_team_work_offsets<TEST_EXECSPACE, Kokkos::Schedule<Kokkos::Dynamic>>(
+        league_size);
+  }
+}
+
+TEST(TEST_CATEGORY_DEATH, team_work_offsets_size_mismatch) {
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+
+  const auto offsets = skewed_work_offsets(10);
+  ASSERT_DEATH(
+      Kokkos::TeamPolicy<TEST_EXECSPACE>(
+          11, 1, Kokkos::Experimental::WorkOffsets(offsets)),
+      "work offsets given for a league of size 11");
+}
+
+}  // namespace
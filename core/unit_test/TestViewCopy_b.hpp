@@ -237,4 +237,60 @@ TEST(TEST_CATEGORY, view_copy_degenerated) {
   Kokkos::deep_copy(v_m_1, v_m_def_2);
   Kokkos::deep_copy(v_m_1, v_m_2);
 }
+
+template <class DstValue, class SrcValue, class DstLayout, class SrcLayout>
+void test_view_copy_layout_conversion(int n0, int n1, int n2) {
+  Kokkos::View<SrcValue***, SrcLayout, TEST_EXECSPACE> src("src", n0, n1, n2);
+  Kokkos::View<DstValue***, DstLayout, TEST_EXECSPACE> dst("dst", n0, n1, n2);
+
+  auto h_src = Kokkos::create_mirror_view(src);
+  for (int i0 = 0; i0 < n0; ++i0)
+    for (int i1 = 0; i1 < n1; ++i1)
+      for (int i2 = 0; i2 < n2; ++i2)
+        h_src(i0, i1, i2) = SrcValue((i0 * n1 + i1) * n2 + i2);
+  Kokkos::deep_copy(src, h_src);
+
+  Kokkos::deep_copy(dst, src);
+  auto h_dst = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dst);
+
+  int errors = 0;
+  for (int i0 = 0; i0 < n0; ++i0)
+    for (int i1 = 0; i1 < n1; ++i1)
+      for (int i2 = 0; i2 < n2; ++i2)
+        if (h_dst(i0, i1, i2) != DstValue(h_src(i0, i1, i2))) ++errors;
+  ASSERT_EQ(errors, 0);
+
+  // Copy a non-contiguous rank 2 subview back
+  Kokkos::View<DstValue**, DstLayout, TEST_EXECSPACE> dst2("dst2", n0, n2);
+  Kokkos::deep_copy(dst2, Kokkos::subview(src, Kokkos::ALL, n1 / 2,
+                                          Kokkos::ALL));
+  auto h_dst2 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dst2);
+
+  for (int i0 = 0; i0 < n0; ++i0)
+    for (int i2 = 0; i2 < n2; ++i2)
+      if (h_dst2(i0, i2) != DstValue(h_src(i0, n1 / 2, i2))) ++errors;
+  ASSERT_EQ(errors, 0);
+}
+
+TEST(TEST_CATEGORY, view_copy_layout_conversion) {
+  using Kokkos::LayoutLeft;
+  using Kokkos::LayoutRight;
+
+  // Extents that are not multiples of the tile or register block sizes
+  test_view_copy_layout_conversion<double, double, LayoutRight, LayoutLeft>(
+      67, 3, 101);
+  test_view_copy_layout_conversion<double, double, LayoutLeft, LayoutRight>(
+      101, 2, 67);
+  test_view_copy_layout_conversion<float, float, LayoutRight, LayoutLeft>(
+      131, 4, 70);
+  test_view_copy_layout_conversion<int, int, LayoutLeft, LayoutRight>(70, 3,
+                                                                      131);
+  test_view_copy_layout_conversion<short, short, LayoutRight, LayoutLeft>(
+      33, 2, 45);
+  test_view_copy_layout_conversion<double, float, LayoutRight, LayoutLeft>(
+      40, 3, 50);
+  // Too small for tiling
+  test_view_copy_layout_conversion<double, double, LayoutRight, LayoutLeft>(
+      5, 7, 9);
+}
 }  // namespace Test
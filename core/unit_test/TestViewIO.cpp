@@ -0,0 +1,127 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <gtest/gtest.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ViewIO.hpp>
+
+#include <cstdio>
+
+namespace {
+
+constexpr char file_name[] = "kokkos_view_io_test.bin";
+
+template <class ViewType>
+void fill(ViewType const& v) {
+  Kokkos::parallel_for(
+      Kokkos::MDRangePolicy<typename ViewType::execution_space,
+                            Kokkos::Rank<2>>({0, 0},
+                                             {v.extent(0), v.extent(1)}),
+      KOKKOS_LAMBDA(int i, int j) { v(i, j) = 1000 * i + j; });
+}
+
+template <class ViewType>
+int count_errors(ViewType const& v) {
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::MDRangePolicy<typename ViewType::execution_space,
+                            Kokkos::Rank<2>>({0, 0},
+                                             {v.extent(0), v.extent(1)}),
+      KOKKOS_LAMBDA(int i, int j, int& update) {
+        if (v(i, j) != 1000 * i + j) ++update;
+      },
+      errors);
+  return errors;
+}
+
+template <class LayoutOut, class LayoutIn>
+void test_view_io_roundtrip(bool direct_io) {
+  // Odd sizes so the span is not a multiple of the O_DIRECT block
+  const int n0 = 123, n1 = 77;
+
+  Kokkos::View<double**, LayoutOut> out("checkpoint", n0, n1);
+  fill(out);
+  Kokkos::Experimental::write_view(file_name, out, direct_io);
+
+  Kokkos::View<double**, LayoutIn> in;
+  Kokkos::Experimental::read_view(file_name, in);
+  ASSERT_EQ(in.label(), "checkpoint");
+  ASSERT_EQ(in.extent(0), out.extent(0));
+  ASSERT_EQ(in.extent(1), out.extent(1));
+  ASSERT_EQ(count_errors(in), 0);
+
+  // Reading again reuses the allocation
+  double* const data = in.data();
+  Kokkos::deep_copy(in, 0.);
+  Kokkos::Experimental::read_view(file_name, in);
+  ASSERT_EQ(in.data(), data);
+  ASSERT_EQ(count_errors(in), 0);
+
+  std::remove(file_name);
+}
+
+TEST(defaultdevicetype, view_io) {
+  for (bool direct_io : {false, true}) {
+    test_view_io_roundtrip<Kokkos::LayoutRight, Kokkos::LayoutRight>(direct_io);
+    test_view_io_roundtrip<Kokkos::LayoutLeft, Kokkos::LayoutLeft>(direct_io);
+    test_view_io_roundtrip<Kokkos::LayoutLeft, Kokkos::LayoutRight>(direct_io);
+    test_view_io_roundtrip<Kokkos::LayoutRight, Kokkos::LayoutStride>(
+        direct_io);
+  }
+}
+
+TEST(defaultdevicetype, view_io_noncontiguous) {
+  Kokkos::View<double**> full("full", 200, 100);
+  fill(full);
+
+  auto sub = Kokkos::subview(full, Kokkos::make_pair(10, 150),
+                             Kokkos::make_pair(0, 50));
+  ASSERT_FALSE(sub.span_is_contiguous());
+  Kokkos::Experimental::write_view(file_name, sub);
+
+  Kokkos::View<double**, Kokkos::HostSpace> in;
+  Kokkos::Experimental::read_view(file_name, in);
+  ASSERT_EQ(in.extent(0), 140u);
+  ASSERT_EQ(in.extent(1), 50u);
+
+  int errors = 0;
+  for (int i = 0; i < 140; ++i)
+    for (int j = 0; j < 50; ++j)
+      if (in(i, j) != 1000 * (i + 10) + j) ++errors;
+  ASSERT_EQ(errors, 0);
+
+  std::remove(file_name);
+}
+
+TEST(defaultdevicetype, view_io_errors) {
+  Kokkos::View<double*> out("out", 10);
+  Kokkos::Experimental::write_view(file_name, out);
+
+  Kokkos::View<float*> wrong_type;
+  ASSERT_THROW(Kokkos::Experimental::read_view(file_name, wrong_type),
+               std::runtime_error);
+
+  Kokkos::View<double**> wrong_rank;
+  ASSERT_THROW(Kokkos::Experimental::read_view(file_name, wrong_rank),
+               std::runtime_error);
+
+  std::remove(file_name);
+
+  Kokkos::View<double*> missing;
+  ASSERT_THROW(Kokkos::Experimental::read_view(file_name, missing),
+               std::runtime_error);
+}
+
+}  // namespace
@@ -210,4 +210,7 @@ using device_abi_set = abi_set<simd_abi::scalar>;
 }  // namespace Experimental
 }  // namespace Kokkos
 
+#include <Kokkos_SIMD_Half.hpp>
+#include <Kokkos_SIMD_View.hpp>
+
 #endif
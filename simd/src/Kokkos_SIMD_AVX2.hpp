@@ -980,6 +980,38 @@ namespace Experimental {
                        static_cast<__m256d>(a)));
 }
 
+namespace Impl {
+
+// 2^n for integral n in [-1022, 1023]: adding 2^52 + 1023 leaves the biased
+// exponent in the low mantissa bits
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx2_fixed_size<4>>
+    exp2_integral(simd<double, simd_abi::avx2_fixed_size<4>> const& n) {
+  __m256i const biased = _mm256_castpd_si256(
+      _mm256_add_pd(static_cast<__m256d>(n), _mm256_set1_pd(0x1p52 + 1023)));
+  return simd<double, simd_abi::avx2_fixed_size<4>>(
+      _mm256_castsi256_pd(_mm256_slli_epi64(biased, 52)));
+}
+
+// significand in [1, 2) and unbiased exponent of a positive normal x
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx2_fixed_size<4>>
+    split_significand(simd<double, simd_abi::avx2_fixed_size<4>> const& x,
+                      simd<double, simd_abi::avx2_fixed_size<4>>& exponent) {
+  __m256i const bits = _mm256_castpd_si256(static_cast<__m256d>(x));
+  __m256d const biased = _mm256_castsi256_pd(_mm256_or_si256(
+      _mm256_srli_epi64(bits, 52),
+      _mm256_castpd_si256(_mm256_set1_pd(0x1p52))));
+  exponent = simd<double, simd_abi::avx2_fixed_size<4>>(
+      _mm256_sub_pd(biased, _mm256_set1_pd(0x1p52 + 1023)));
+  return simd<double, simd_abi::avx2_fixed_size<4>>(
+      _mm256_castsi256_pd(_mm256_or_si256(
+          _mm256_and_si256(bits, _mm256_set1_epi64x(0x000fffffffffffff)),
+          _mm256_castpd_si256(_mm256_set1_pd(1.0)))));
+}
+
+}  // namespace Impl
+
 template <>
 class simd<float, simd_abi::avx2_fixed_size<4>> {
   __m128 m_value;
@@ -2231,6 +2263,11 @@ class simd<std::uint64_t, simd_abi::avx2_fixed_size<4>> {
     return _mm256_or_si256(static_cast<__m256i>(lhs),
                            static_cast<__m256i>(rhs));
   }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator^(
+      simd const& lhs, simd const& rhs) noexcept {
+    return _mm256_xor_si256(static_cast<__m256i>(lhs),
+                            static_cast<__m256i>(rhs));
+  }
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
   operator==(simd const& lhs, simd const& rhs) noexcept {
     return mask_type(_mm256_cmpeq_epi64(static_cast<__m256i>(lhs),
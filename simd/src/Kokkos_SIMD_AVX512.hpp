@@ -357,8 +357,8 @@ class simd<double, simd_abi::avx512_fixed_size<8>> {
   }
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
   operator>(simd const& lhs, simd const& rhs) noexcept {
-    return mask_type(_mm512_cmp_pd_mask(static_cast<__m512d>(rhs),
-                                        static_cast<__m512d>(lhs), _CMP_GT_OS));
+    return mask_type(_mm512_cmp_pd_mask(static_cast<__m512d>(lhs),
+                                        static_cast<__m512d>(rhs), _CMP_GT_OS));
   }
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
   operator<=(simd const& lhs, simd const& rhs) noexcept {
@@ -367,8 +367,8 @@ class simd<double, simd_abi::avx512_fixed_size<8>> {
   }
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
   operator>=(simd const& lhs, simd const& rhs) noexcept {
-    return mask_type(_mm512_cmp_pd_mask(static_cast<__m512d>(rhs),
-                                        static_cast<__m512d>(lhs), _CMP_GE_OS));
+    return mask_type(_mm512_cmp_pd_mask(static_cast<__m512d>(lhs),
+                                        static_cast<__m512d>(rhs), _CMP_GE_OS));
   }
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
   operator==(simd const& lhs, simd const& rhs) noexcept {
@@ -549,6 +549,30 @@ namespace Experimental {
                            static_cast<__m512d>(b)));
 }
 
+namespace Impl {
+
+// 2^n for integral n in [-1022, 1023]
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx512_fixed_size<8>>
+    exp2_integral(simd<double, simd_abi::avx512_fixed_size<8>> const& n) {
+  return simd<double, simd_abi::avx512_fixed_size<8>>(
+      _mm512_scalef_pd(_mm512_set1_pd(1.0), static_cast<__m512d>(n)));
+}
+
+// significand in [1, 2) and unbiased exponent of a positive normal x
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx512_fixed_size<8>>
+    split_significand(
+        simd<double, simd_abi::avx512_fixed_size<8>> const& x,
+        simd<double, simd_abi::avx512_fixed_size<8>>& exponent) {
+  exponent = simd<double, simd_abi::avx512_fixed_size<8>>(
+      _mm512_getexp_pd(static_cast<__m512d>(x)));
+  return simd<double, simd_abi::avx512_fixed_size<8>>(_mm512_getmant_pd(
+      static_cast<__m512d>(x), _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero));
+}
+
+}  // namespace Impl
+
 template <>
 class simd<float, simd_abi::avx512_fixed_size<8>> {
   __m256 m_value;
@@ -2254,6 +2278,11 @@ class simd<std::uint64_t, simd_abi::avx512_fixed_size<8>> {
     return _mm512_or_epi64(static_cast<__m512i>(lhs),
                            static_cast<__m512i>(rhs));
   }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator^(
+      simd const& lhs, simd const& rhs) noexcept {
+    return _mm512_xor_epi64(static_cast<__m512i>(lhs),
+                            static_cast<__m512i>(rhs));
+  }
 
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
   operator<(simd const& lhs, simd const& rhs) noexcept {
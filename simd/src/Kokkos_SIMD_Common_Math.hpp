@@ -115,6 +115,533 @@ template <class T, class Abi>
 }  // namespace Experimental
 #endif
 
+// vectorized implementations of the most commonly used <cmath> functions for
+// the native double precision Abi types. Every Abi header that defines
+// simd<double, Abi> also provides the two bit-level primitives
+// Impl::exp2_integral and Impl::split_significand, everything else is written
+// in terms of the simd interface. The kernels stay within 1 ULP of the
+// correctly rounded result (2 ULP for tanh); sin and cos hand lanes with
+// |x| > 2^20 to the scalar implementation.
+
+#if defined(KOKKOS_SIMD_AVX2_HPP) || defined(KOKKOS_SIMD_AVX512_HPP) || \
+    defined(KOKKOS_SIMD_NEON_HPP)
+
+namespace Experimental {
+namespace Impl {
+
+// s + e == a + b exactly; the outputs may alias the inputs
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void simd_two_sum(
+    simd<double, Abi> const& a, simd<double, Abi> const& b,
+    simd<double, Abi>& s, simd<double, Abi>& e) {
+  simd<double, Abi> const sum   = a + b;
+  simd<double, Abi> const b_rnd = sum - a;
+  e = (a - (sum - b_rnd)) + (b - b_rnd);
+  s = sum;
+}
+
+// s + e == a + b exactly, provided |a| >= |b|
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void simd_fast_two_sum(
+    simd<double, Abi> const& a, simd<double, Abi> const& b,
+    simd<double, Abi>& s, simd<double, Abi>& e) {
+  simd<double, Abi> const sum = a + b;
+  e                           = b - (sum - a);
+  s                           = sum;
+}
+
+// p + e == a * b exactly. The product is formed with an fma so that the
+// compiler cannot contract it into a later addition, which would break the
+// error-free transformations built on top of it.
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void simd_two_prod(
+    simd<double, Abi> const& a, simd<double, Abi> const& b,
+    simd<double, Abi>& p, simd<double, Abi>& e) {
+  simd<double, Abi> const prod = Kokkos::fma(a, b, simd<double, Abi>(0.0));
+  e                            = Kokkos::fma(a, b, -prod);
+  p                            = prod;
+}
+
+template <class Abi, std::size_t N>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_horner(
+    simd<double, Abi> const& x, double const (&coeffs)[N]) {
+  simd<double, Abi> result(coeffs[N - 1]);
+  for (std::size_t i = N - 1; i-- > 0;) {
+    result = Kokkos::fma(result, x, simd<double, Abi>(coeffs[i]));
+  }
+  return result;
+}
+
+// e^r - 1 for |r| <= ln(2) / 2
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_expm1_reduced(
+    simd<double, Abi> const& r) {
+  // Taylor coefficients 1/2! ... 1/13!
+  static constexpr double coeffs[] = {
+      0.5,
+      0.16666666666666666,
+      0.041666666666666664,
+      0.008333333333333333,
+      0.001388888888888889,
+      0.0001984126984126984,
+      2.48015873015873e-05,
+      2.7557319223985893e-06,
+      2.755731922398589e-07,
+      2.505210838544172e-08,
+      2.08767569878681e-09,
+      1.6059043836821613e-10};
+  return Kokkos::fma(r * r, simd_horner(r, coeffs), r);
+}
+
+// (1 + p) * 2^k for integral k in [-1080, 1080]; the split of the scaling
+// keeps both factors normal so that only the last product rounds
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_exp_scale(
+    simd<double, Abi> const& p, simd<double, Abi> const& k) {
+  simd<double, Abi> const k1 = Kokkos::floor(k * simd<double, Abi>(0.5));
+  return ((simd<double, Abi>(1.0) + p) * exp2_integral(k1)) *
+         exp2_integral(k - k1);
+}
+
+inline constexpr double simd_ln2_hi    = 6.93147180369123816490e-01;
+inline constexpr double simd_ln2_lo    = 1.90821492927058770002e-10;
+inline constexpr double simd_log2e     = 1.4426950408889634;
+inline constexpr double simd_log2e_lo  = 2.0355273740931033e-17;
+inline constexpr double simd_log10e    = 0.4342944819032518;
+inline constexpr double simd_log10e_lo = 1.098319650216765e-17;
+
+// e^(hi + lo) for |lo| <= ulp(hi); NaN is not propagated
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_exp_dd(
+    simd<double, Abi> const& hi, simd<double, Abi> const& lo) {
+  using simd_type     = simd<double, Abi>;
+  auto const in_range = (hi > simd_type(-746.0)) && (hi < simd_type(710.0));
+  simd_type const x =
+      condition(in_range, hi,
+                condition(hi > simd_type(0.0), simd_type(710.0),
+                          simd_type(-746.0)));
+  simd_type const k = Kokkos::round(x * simd_type(simd_log2e));
+  // exact: k * ln2_hi has at most 43 significant bits
+  simd_type const r_hi = Kokkos::fma(-k, simd_type(simd_ln2_hi), x);
+  simd_type const r_lo =
+      condition(in_range, lo, simd_type(0.0)) - k * simd_type(simd_ln2_lo);
+  return simd_exp_scale(simd_expm1_reduced(r_hi + r_lo), k);
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_exp(
+    simd<double, Abi> const& x) {
+  simd<double, Abi> const result = simd_exp_dd(x, simd<double, Abi>(0.0));
+  return condition(x == x, result, x);
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_exp2(
+    simd<double, Abi> const& x) {
+  using simd_type   = simd<double, Abi>;
+  simd_type const c = Kokkos::min(Kokkos::max(x, simd_type(-1080.0)),
+                                  simd_type(1030.0));
+  simd_type const k = Kokkos::round(c);
+  simd_type const f = c - k;
+  // f * ln(2) with ln(2) in double-double
+  simd_type const r = Kokkos::fma(f, simd_type(0.6931471805599453),
+                                  f * simd_type(2.3190468138462996e-17));
+  return condition(x == x, simd_exp_scale(simd_expm1_reduced(r), k), x);
+}
+
+// e^x - 1 for x <= 709
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_expm1(
+    simd<double, Abi> const& x) {
+  using simd_type      = simd<double, Abi>;
+  simd_type const k    = Kokkos::round(x * simd_type(simd_log2e));
+  simd_type const r_hi = Kokkos::fma(-k, simd_type(simd_ln2_hi), x);
+  simd_type const r_lo = -k * simd_type(simd_ln2_lo);
+  simd_type const r    = r_hi + r_lo;
+  simd_type const p    = simd_expm1_reduced(r) + ((r_hi - r) + r_lo);
+  // 2^k * (1 + p) - 1, where 2^k - 1 is exact for the k that matter
+  simd_type const scale = exp2_integral(k);
+  return Kokkos::fma(scale, p, scale - simd_type(1.0));
+}
+
+// ln(x) as hi + lo with a relative error below 2^-64, for positive finite x
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void simd_log_dd(
+    simd<double, Abi> const& x, simd<double, Abi>& hi,
+    simd<double, Abi>& lo) {
+  using simd_type = simd<double, Abi>;
+  // scale subnormals into the normal range
+  auto const subnormal = x < simd_type(0x1p-1022);
+  simd_type k;
+  simd_type m = split_significand(
+      condition(subnormal, x * simd_type(0x1p54), x), k);
+  k = condition(subnormal, k - simd_type(54.0), k);
+  // x = m * 2^k with m in [sqrt(2)/2, sqrt(2)]
+  auto const upper = m > simd_type(1.4142135623730951);
+  m                = condition(upper, m * simd_type(0.5), m);
+  k                = condition(upper, k + simd_type(1.0), k);
+  // ln(m) = 2 atanh(s) with s = f / (2 + f), f = m - 1 exact
+  simd_type const f = m - simd_type(1.0);
+  simd_type d_hi, d_lo;
+  simd_fast_two_sum(simd_type(2.0), f, d_hi, d_lo);
+  simd_type const s = f / d_hi;
+  simd_type const s_lo =
+      (Kokkos::fma(-s, d_hi, f) - s * d_lo) / d_hi;
+  // 2 s + 2/3 s^3 + s^5 (2/5 + 2/7 s^2 + ...), leading terms in
+  // double-double
+  simd_type z, z_lo;
+  simd_two_prod(s, s, z, z_lo);
+  simd_type s3, s3_lo;
+  simd_two_prod(s, z, s3, s3_lo);
+  s3_lo = Kokkos::fma(s, z_lo, s3_lo) +
+          simd_type(3.0) * z * s_lo;
+  simd_type t, t_lo;
+  simd_two_prod(simd_type(0.6666666666666666), s3, t, t_lo);
+  t_lo = t_lo + Kokkos::fma(simd_type(0.6666666666666666), s3_lo,
+                            simd_type(3.700743415417188e-17) * s3);
+  static constexpr double coeffs[] = {
+      0.4,  0.2857142857142857,  0.2222222222222222,  0.18181818181818182,
+      0.15384615384615385, 0.13333333333333333, 0.11764705882352941,
+      0.10526315789473684, 0.09523809523809523, 0.08695652173913043, 0.08};
+  simd_type const tail = s3 * z * simd_horner(z, coeffs);
+  simd_type h, h_lo;
+  simd_fast_two_sum(simd_type(2.0) * s, t, h, h_lo);
+  h_lo = h_lo + (simd_type(2.0) * s_lo + t_lo + tail);
+  // + k ln(2), k * ln2_hi is exact
+  simd_type sum, sum_lo;
+  simd_two_sum(k * simd_type(simd_ln2_hi), h, sum, sum_lo);
+  simd_fast_two_sum(sum, sum_lo + h_lo + k * simd_type(simd_ln2_lo), hi, lo);
+}
+
+// the special values of the logarithm of x, applied to result
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_log_special(
+    simd<double, Abi> const& x, simd<double, Abi> result) {
+  using simd_type     = simd<double, Abi>;
+  simd_type const inf = simd_type(Kokkos::Experimental::infinity_v<double>);
+  result = condition(x == simd_type(0.0), -inf, result);
+  result = condition(x < simd_type(0.0),
+                     simd_type(Kokkos::Experimental::quiet_NaN_v<double>),
+                     result);
+  result = condition(x == inf, x, result);
+  return condition(x == x, result, x);
+}
+
+// ln(x) * c, with c given in double-double
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_log_scaled(
+    simd<double, Abi> const& x, double c_hi, double c_lo) {
+  using simd_type = simd<double, Abi>;
+  simd_type hi, lo;
+  simd_log_dd(x, hi, lo);
+  simd_type p, p_lo;
+  simd_two_prod(hi, simd_type(c_hi), p, p_lo);
+  return simd_log_special(
+      x, p + (p_lo + Kokkos::fma(hi, simd_type(c_lo), lo * simd_type(c_hi))));
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_log(
+    simd<double, Abi> const& x) {
+  simd<double, Abi> hi, lo;
+  simd_log_dd(x, hi, lo);
+  return simd_log_special(x, hi);
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_log2(
+    simd<double, Abi> const& x) {
+  return simd_log_scaled(x, simd_log2e, simd_log2e_lo);
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_log10(
+    simd<double, Abi> const& x) {
+  return simd_log_scaled(x, simd_log10e, simd_log10e_lo);
+}
+
+// fdlibm's __kernel_sin and __kernel_cos, for |x| <= pi/4 and x + y the
+// double-double reduced argument
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_sin_reduced(
+    simd<double, Abi> const& x, simd<double, Abi> const& y) {
+  using simd_type   = simd<double, Abi>;
+  simd_type const z = x * x;
+  simd_type const w = z * z;
+  simd_type const r =
+      simd_type(8.33333333332248946124e-03) +
+      z * (simd_type(-1.98412698298579493134e-04) +
+           z * simd_type(2.75573137070700676789e-06)) +
+      z * w *
+          (simd_type(-2.50507602534068634195e-08) +
+           z * simd_type(1.58969099521155010221e-10));
+  simd_type const v = z * x;
+  return x - ((z * (simd_type(0.5) * y - v * r) - y) -
+              v * simd_type(-1.66666666666666324348e-01));
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_cos_reduced(
+    simd<double, Abi> const& x, simd<double, Abi> const& y) {
+  using simd_type   = simd<double, Abi>;
+  simd_type const z = x * x;
+  simd_type const w = z * z;
+  simd_type const r =
+      z * (simd_type(4.16666666666666019037e-02) +
+           z * (simd_type(-1.38888888888741095749e-03) +
+                z * simd_type(2.48015872894767294178e-05))) +
+      w * w *
+          (simd_type(-2.75573143513906633035e-07) +
+           z * (simd_type(2.08757232129817482790e-09) +
+                z * simd_type(-1.13596475577881948265e-11)));
+  simd_type const hz  = simd_type(0.5) * z;
+  simd_type const one = simd_type(1.0);
+  simd_type const u   = one - hz;
+  return u + (((one - u) - hz) + (z * r - x * y));
+}
+
+template <bool Cosine, class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_sin_cos(
+    simd<double, Abi> const& x) {
+  using simd_type   = simd<double, Abi>;
+  simd_type const n = Kokkos::round(x * simd_type(0.6366197723675814));
+  // x - n pi/2 in double-double, with pi/2 split into 33 bit pieces so that
+  // the products with n (|n| < 2^20) are exact
+  simd_type y, y_lo;
+  simd_two_sum(Kokkos::fma(-n, simd_type(1.5707963267341256), x),
+               -n * simd_type(6.077100506303966e-11), y, y_lo);
+  y_lo = y_lo - Kokkos::fma(n, simd_type(2.0222662487111665e-21),
+                            n * simd_type(8.4784276603689e-32));
+  simd_two_sum(y, y_lo, y, y_lo);
+  simd_type const s = simd_sin_reduced(y, y_lo);
+  simd_type const c = simd_cos_reduced(y, y_lo);
+  simd_type const q =
+      n - simd_type(4.0) * Kokkos::floor(n * simd_type(0.25));
+  auto const odd = (q == simd_type(1.0)) || (q == simd_type(3.0));
+  simd_type result;
+  if constexpr (Cosine) {
+    result = condition(odd, s, c);
+    result = condition((q == simd_type(1.0)) || (q == simd_type(2.0)),
+                       -result, result);
+  } else {
+    result = condition(odd, c, s);
+    result = condition(q >= simd_type(2.0), -result, result);
+    result = condition(x == simd_type(0.0), x, result);
+  }
+  auto const large = !(Kokkos::abs(x) <= simd_type(0x1p20));
+  if (any_of(large)) {
+    for (std::size_t i = 0; i < simd_type::size(); ++i) {
+      if (large[i]) {
+        result[i] = Cosine ? Kokkos::cos(x[i]) : Kokkos::sin(x[i]);
+      }
+    }
+  }
+  return result;
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_sin(
+    simd<double, Abi> const& x) {
+  return simd_sin_cos<false>(x);
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_cos(
+    simd<double, Abi> const& x) {
+  return simd_sin_cos<true>(x);
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_tanh(
+    simd<double, Abi> const& x) {
+  using simd_type   = simd<double, Abi>;
+  simd_type const a = Kokkos::abs(x);
+  simd_type const em =
+      simd_expm1(simd_type(2.0) * Kokkos::min(a, simd_type(22.0)));
+  simd_type const two = simd_type(2.0);
+  // below ln(3)/2, em / (em + 2) with the denominator and the quotient
+  // corrected in double-double
+  simd_type d, d_lo;
+  simd_fast_two_sum(two, em, d, d_lo);
+  simd_type const q = em / d;
+  simd_type const small =
+      q + (Kokkos::fma(-q, d, em) - q * d_lo) / d;
+  // above it the 1 - 2/(e^2x + 1) form avoids the cancellation
+  simd_type const result =
+      condition(a > simd_type(0.5493061443340549),
+                simd_type(1.0) - two / (em + two), small);
+  return condition(x == x, Kokkos::copysign(result, x), x);
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_erf(
+    simd<double, Abi> const& x) {
+  using simd_type = simd<double, Abi>;
+  // erf(x) rounds to 1 from x = 5.93 on
+  simd_type const a = Kokkos::min(Kokkos::abs(x), simd_type(6.0));
+  // |x| < 1: x P(x^2), with the leading coefficient 2/sqrt(pi) split
+  static constexpr double small_coeffs[] = {
+      -0.37612638903183543,   0.11283791670945006,   -0.02686617064323777,
+      0.0052239776071164225,  -0.0008548325975389692, 0.00012055294904839707,
+      -1.492473690741966e-05, 1.6447424703317362e-06, -1.6208483801871705e-07,
+      1.3720064546777686e-08, -7.795898827002142e-10};
+  simd_type const z = a * a;
+  simd_type const small =
+      Kokkos::fma(a, simd_type(1.1283791670955126),
+                  a * Kokkos::fma(z, simd_horner(z, small_coeffs),
+                                  simd_type(7.975362179473325e-18)));
+  // 1 <= |x| <= 6: 1 - e^(-x^2) erfcx(x), erfcx interpolated on four
+  // intervals in t = (|x| - mid) / half_width
+  static constexpr double mids[]        = {1.375, 2.125, 3.125, 4.875};
+  static constexpr double inv_widths[]  = {2.6666666666666665,
+                                          2.6666666666666665, 1.6,
+                                          0.8888888888888888};
+  static constexpr double coeffs[4][14] = {
+      {0.3432958898621254, -0.06911830124050042, 0.012636860434724546,
+       -0.0021359199668586426, 0.00033786238292188287, -5.046138167713453e-05,
+       7.164248857005627e-06, -9.720187595078627e-07, 1.265698791947655e-07,
+       -1.5873017279705147e-08, 1.9213341130480426e-09,
+       -2.2541403734180204e-10, 2.6779496466898168e-11,
+       -2.9582800691429326e-12},
+      {0.24267036461265454, -0.036386294059399034, 0.005130191945070747,
+       -0.000685800597249703, 8.74679456742495e-05, -1.0695875912918325e-05,
+       1.2589678952500706e-06, -1.4310499646850819e-07,
+       1.5751445474665702e-08, -1.6827271667176864e-09,
+       1.7474563625988826e-10, -1.768728804373764e-11, 1.804077506414043e-12,
+       -1.7382771845471194e-13},
+      {0.17244435210217368, -0.03162622903557971, 0.00559109645478643,
+       -0.0009559236358334982, 0.00015849185084372365,
+       -2.5541309751814897e-05, 4.008502052951301e-06, -6.137047355664315e-07,
+       9.179711651286142e-08, -1.3431804661570575e-08, 1.9213960422842656e-09,
+       -2.699799209618855e-10, 3.9721615777710354e-11,
+       -5.3673328516704015e-12},
+      {0.11343587721474323, -0.025176784783267386, 0.005488353053908493,
+       -0.0011761213064993895, 0.00024795327607826916, -5.146392221803038e-05,
+       1.0522779553954199e-05, -2.1208570538112935e-06, 4.216537940719616e-07,
+       -8.27036790599883e-08, 1.590614365296921e-08, -3.042805616958363e-09,
+       6.535639486761452e-10, -1.2172628376355609e-10}};
+  auto const in0 = a < simd_type(1.75);
+  auto const in1 = a < simd_type(2.5);
+  auto const in2 = a < simd_type(3.75);
+  auto const pick = [&](double const (&c)[4]) {
+    return condition(
+        in0, simd_type(c[0]),
+        condition(in1, simd_type(c[1]),
+                  condition(in2, simd_type(c[2]), simd_type(c[3]))));
+  };
+  simd_type const t =
+      (a - pick(mids)) * pick(inv_widths);
+  simd_type erfcx = pick({coeffs[0][13], coeffs[1][13], coeffs[2][13],
+                          coeffs[3][13]});
+  for (int i = 12; i >= 0; --i) {
+    erfcx = Kokkos::fma(erfcx, t,
+                        pick({coeffs[0][i], coeffs[1][i], coeffs[2][i],
+                              coeffs[3][i]}));
+  }
+  simd_type sq, sq_lo;
+  simd_two_prod(a, a, sq, sq_lo);
+  simd_type const large = Kokkos::fma(-simd_exp_dd(-sq, -sq_lo), erfcx,
+                                      simd_type(1.0));
+  simd_type const result = condition(a < simd_type(1.0), small, large);
+  return condition(x == x, Kokkos::copysign(result, x), x);
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_pow(
+    simd<double, Abi> const& x, simd<double, Abi> const& y) {
+  using simd_type      = simd<double, Abi>;
+  simd_type const zero = simd_type(0.0);
+  simd_type const one  = simd_type(1.0);
+  simd_type const inf  = simd_type(Kokkos::Experimental::infinity_v<double>);
+  simd_type const ax   = Kokkos::abs(x);
+  // e^(y ln|x|) with the product in double-double, on sanitized arguments
+  simd_type log_hi, log_lo;
+  simd_log_dd(condition((ax > zero) && (ax < inf), ax, one), log_hi, log_lo);
+  // any |y| >= 2^64 over- or underflows unless |x| == 1
+  simd_type const ys =
+      condition(Kokkos::abs(y) < simd_type(0x1p64), y,
+                Kokkos::copysign(simd_type(0x1p64), y));
+  simd_type p, p_lo;
+  simd_two_prod(ys, log_hi, p, p_lo);
+  p_lo = Kokkos::fma(ys, log_lo, p_lo);
+  simd_fast_two_sum(p, p_lo, p, p_lo);
+  simd_type result = simd_exp_dd(p, p_lo);
+  // special values, following C99 Annex F
+  auto const y_int      = Kokkos::trunc(y) == y;
+  simd_type const y_half = simd_type(0.5) * y;
+  auto const y_odd      = y_int && !(Kokkos::trunc(y_half) == y_half);
+  auto const y_negative = y < zero;
+  result = condition(ax == zero, condition(y_negative, inf, zero), result);
+  result = condition(ax == inf, condition(y_negative, zero, inf), result);
+  auto const ax_above = ax > one;
+  auto const ax_below = ax < one;
+  result = condition(
+      Kokkos::abs(y) == inf,
+      condition(ax_above, condition(y_negative, zero, inf),
+                condition(ax_below, condition(y_negative, inf, zero), one)),
+      result);
+  result = condition(y_odd, Kokkos::copysign(result, x), result);
+  result = condition((x < zero) && (x > -inf) && !y_int,
+                     simd_type(Kokkos::Experimental::quiet_NaN_v<double>),
+                     result);
+  result = condition((x == x) && (y == y), result,
+                     simd_type(Kokkos::Experimental::quiet_NaN_v<double>));
+  return condition((y == zero) || (x == one), one, result);
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+
+#define KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(FUNC, ABI)                 \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                     \
+      Experimental::simd<double, Experimental::simd_abi::ABI>             \
+      FUNC(Experimental::simd<double, Experimental::simd_abi::ABI> const& \
+               a) {                                                       \
+    return Experimental::Impl::simd_##FUNC(a);                            \
+  }
+
+#define KOKKOS_IMPL_SIMD_DOUBLE_FUNCTIONS(ABI)                               \
+  KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(exp2, ABI)                          \
+  KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(log2, ABI)                          \
+  KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(log10, ABI)                         \
+  KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(sin, ABI)                           \
+  KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(cos, ABI)                           \
+  KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(tanh, ABI)                          \
+  KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(erf, ABI)                           \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                        \
+      Experimental::simd<double, Experimental::simd_abi::ABI>                \
+      pow(Experimental::simd<double, Experimental::simd_abi::ABI> const& a,  \
+          Experimental::simd<double, Experimental::simd_abi::ABI> const& b) { \
+    return Experimental::Impl::simd_pow(a, b);                               \
+  }
+
+#ifdef KOKKOS_SIMD_AVX2_HPP
+KOKKOS_IMPL_SIMD_DOUBLE_FUNCTIONS(avx2_fixed_size<4>)
+#ifndef __INTEL_COMPILER
+KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(exp, avx2_fixed_size<4>)
+KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(log, avx2_fixed_size<4>)
+#endif
+#endif
+
+#ifdef KOKKOS_SIMD_AVX512_HPP
+KOKKOS_IMPL_SIMD_DOUBLE_FUNCTIONS(avx512_fixed_size<8>)
+#ifndef __INTEL_COMPILER
+KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(exp, avx512_fixed_size<8>)
+KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(log, avx512_fixed_size<8>)
+#endif
+#endif
+
+#ifdef KOKKOS_SIMD_NEON_HPP
+KOKKOS_IMPL_SIMD_DOUBLE_FUNCTIONS(neon_fixed_size<2>)
+KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(exp, neon_fixed_size<2>)
+KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION(log, neon_fixed_size<2>)
+#endif
+
+#undef KOKKOS_IMPL_SIMD_DOUBLE_FUNCTIONS
+#undef KOKKOS_IMPL_SIMD_DOUBLE_UNARY_FUNCTION
+
+#endif
+
 // fallback implementations of <cmath> functions.
 // individual Abi types may provide overloads with more efficient
 // implementations.
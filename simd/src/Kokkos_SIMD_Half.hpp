@@ -0,0 +1,577 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_HALF_HPP
+#define KOKKOS_SIMD_HALF_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <Kokkos_SIMD_Common.hpp>
+#include <Kokkos_BitManipulation.hpp>  // bit_cast
+
+#if defined(__F16C__) || defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+// Packs of half_t and bhalf_t, and bulk conversions between Views of them
+// and Views of float.
+//
+// The packs keep their lanes widened to float and convert when they are
+// loaded from or stored to memory, so a View of half_t or bhalf_t is read and
+// written at 16 bits per element. Arithmetic is done in float and rounded to
+// the 16-bit format only when the pack is stored, so a chain of operations can
+// differ from the scalar type, which rounds after each one, in the last bit.
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+// IEEE binary16 <-> binary32, rounding to nearest even
+KOKKOS_FORCEINLINE_FUNCTION float binary16_bits_to_float(std::uint16_t bits) {
+  std::uint32_t const sign     = std::uint32_t(bits & 0x8000u) << 16;
+  std::uint32_t const exponent = (bits >> 10) & 0x1fu;
+  std::uint32_t const mantissa = bits & 0x3ffu;
+  if (exponent == 0x1fu) {  // inf or NaN, quieted
+    std::uint32_t const quiet = mantissa != 0 ? 0x400000u : 0u;
+    return Kokkos::bit_cast<float>(sign | 0x7f800000u | quiet |
+                                   (mantissa << 13));
+  }
+  if (exponent != 0) {
+    return Kokkos::bit_cast<float>(sign | ((exponent + 112) << 23) |
+                                   (mantissa << 13));
+  }
+  // zero or subnormal, mantissa * 2^-24 is exact
+  float const value = float(mantissa) * 0x1p-24f;
+  return sign != 0 ? -value : value;
+}
+
+KOKKOS_FORCEINLINE_FUNCTION std::uint16_t float_to_binary16_bits(float value) {
+  std::uint32_t const bits = Kokkos::bit_cast<std::uint32_t>(value);
+  std::uint32_t const sign = (bits >> 16) & 0x8000u;
+  std::uint32_t const abs  = bits & 0x7fffffffu;
+  if (abs > 0x7f800000u) {  // NaN, quieted
+    return std::uint16_t(sign | 0x7e00u | ((abs >> 13) & 0x3ffu));
+  }
+  if (abs >= 0x477ff000u) {  // rounds past 65504
+    return std::uint16_t(sign | 0x7c00u);
+  }
+  if (abs >= 0x38800000u) {  // normal, a carry into the exponent is correct
+    std::uint32_t const rounded = abs + 0xfffu + ((abs >> 13) & 1u);
+    return std::uint16_t(sign | ((rounded - 0x38000000u) >> 13));
+  }
+  if (abs <= 0x33000000u) {  // at most half the smallest subnormal
+    return std::uint16_t(sign);
+  }
+  // subnormal: the significand shifted to units of 2^-24
+  std::uint32_t const shift     = 126 - (abs >> 23);
+  std::uint32_t const mantissa  = (abs & 0x7fffffu) | 0x800000u;
+  std::uint32_t result          = mantissa >> shift;
+  std::uint32_t const remainder = mantissa & ((1u << shift) - 1);
+  std::uint32_t const half      = 1u << (shift - 1);
+  if (remainder > half || (remainder == half && (result & 1u))) ++result;
+  return std::uint16_t(sign | result);
+}
+
+// bfloat16 <-> binary32, rounding to nearest even
+KOKKOS_FORCEINLINE_FUNCTION float bfloat16_bits_to_float(std::uint16_t bits) {
+  return Kokkos::bit_cast<float>(std::uint32_t(bits) << 16);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION std::uint16_t float_to_bfloat16_bits(
+    float value) {
+  std::uint32_t const bits = Kokkos::bit_cast<std::uint32_t>(value);
+  if ((bits & 0x7fffffffu) > 0x7f800000u) {  // NaN, quieted
+    return std::uint16_t((bits >> 16) | 0x40u);
+  }
+  return std::uint16_t((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16);
+}
+
+// Bulk conversions of n values, vectorized with F16C, AVX2, AVX512F,
+// AVX512-BF16 or NEON when the compiler targets them. They give the same bits
+// as the scalar conversions above.
+
+inline void convert_binary16_to_float(std::uint16_t const* src, float* dst,
+                                      std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX512F__)
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(_mm256_loadu_si256(
+                                  reinterpret_cast<__m256i const*>(src + i))));
+  }
+#endif
+#if defined(__F16C__)
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(
+                                  reinterpret_cast<__m128i const*>(src + i))));
+  }
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_ps(dst + i, _mm_cvtph_ps(_mm_loadl_epi64(
+                               reinterpret_cast<__m128i const*>(src + i))));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; i + 4 <= n; i += 4) {
+    vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = binary16_bits_to_float(src[i]);
+}
+
+inline void convert_float_to_binary16(float const* src, std::uint16_t* dst,
+                                      std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX512F__)
+  for (; i + 16 <= n; i += 16) {
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(dst + i),
+        _mm512_cvtps_ph(_mm512_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+  }
+#endif
+#if defined(__F16C__)
+  for (; i + 8 <= n; i += 8) {
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(dst + i),
+        _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+  }
+  for (; i + 4 <= n; i += 4) {
+    _mm_storel_epi64(
+        reinterpret_cast<__m128i*>(dst + i),
+        _mm_cvtps_ph(_mm_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; i + 4 <= n; i += 4) {
+    vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = float_to_binary16_bits(src[i]);
+}
+
+inline void convert_bfloat16_to_float(std::uint16_t const* src, float* dst,
+                                      std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX512F__)
+  for (; i + 16 <= n; i += 16) {
+    __m512i const wide = _mm512_cvtepu16_epi32(
+        _mm256_loadu_si256(reinterpret_cast<__m256i const*>(src + i)));
+    _mm512_storeu_si512(dst + i, _mm512_slli_epi32(wide, 16));
+  }
+#endif
+#if defined(__AVX2__)
+  for (; i + 8 <= n; i += 8) {
+    __m256i const wide = _mm256_cvtepu16_epi32(
+        _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+                        _mm256_slli_epi32(wide, 16));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; i + 4 <= n; i += 4) {
+    vst1q_f32(dst + i,
+              vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(src + i), 16)));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = bfloat16_bits_to_float(src[i]);
+}
+
+inline void convert_float_to_bfloat16(float const* src, std::uint16_t* dst,
+                                      std::size_t n) {
+  std::size_t i = 0;
+#if defined(__AVX512F__)
+  for (; i + 16 <= n; i += 16) {
+    __m512 const value = _mm512_loadu_ps(src + i);
+    __m512i const bits = _mm512_castps_si512(value);
+#if defined(__AVX512BF16__) && defined(__AVX512VL__)
+    // the instruction flushes subnormals to zero, which are rounded below
+    __mmask16 const subnormal = _mm512_cmplt_epu32_mask(
+        _mm512_sub_epi32(_mm512_and_si512(bits, _mm512_set1_epi32(0x7fffffff)),
+                         _mm512_set1_epi32(1)),
+        _mm512_set1_epi32(0x7fffff));
+    if (subnormal == 0) {
+      __m256bh const narrow = _mm512_cvtneps_pbh(value);
+      std::memcpy(dst + i, &narrow, sizeof(narrow));
+      continue;
+    }
+#endif
+    __m512i const upper = _mm512_srli_epi32(bits, 16);
+    __m512i const bias  = _mm512_add_epi32(
+        _mm512_and_si512(upper, _mm512_set1_epi32(1)),
+        _mm512_set1_epi32(0x7fff));
+    __m512i const rounded =
+        _mm512_srli_epi32(_mm512_add_epi32(bits, bias), 16);
+    __m512i const quiet = _mm512_or_si512(upper, _mm512_set1_epi32(0x40));
+    __mmask16 const nan = _mm512_cmp_ps_mask(value, value, _CMP_UNORD_Q);
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(dst + i),
+        _mm512_cvtepi32_epi16(_mm512_mask_blend_epi32(nan, rounded, quiet)));
+  }
+#endif
+#if defined(__AVX2__)
+  for (; i + 8 <= n; i += 8) {
+    __m256 const value  = _mm256_loadu_ps(src + i);
+    __m256i const bits  = _mm256_castps_si256(value);
+    __m256i const upper = _mm256_srli_epi32(bits, 16);
+    __m256i const bias  = _mm256_add_epi32(
+        _mm256_and_si256(upper, _mm256_set1_epi32(1)),
+        _mm256_set1_epi32(0x7fff));
+    __m256i const rounded =
+        _mm256_srli_epi32(_mm256_add_epi32(bits, bias), 16);
+    __m256i const quiet = _mm256_or_si256(upper, _mm256_set1_epi32(0x40));
+    __m256i const nan =
+        _mm256_castps_si256(_mm256_cmp_ps(value, value, _CMP_UNORD_Q));
+    __m256i const result = _mm256_blendv_epi8(rounded, quiet, nan);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_packus_epi32(_mm256_castsi256_si128(result),
+                                      _mm256_extracti128_si256(result, 1)));
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; i + 4 <= n; i += 4) {
+    float32x4_t const value = vld1q_f32(src + i);
+    uint32x4_t const bits   = vreinterpretq_u32_f32(value);
+    uint32x4_t const bias   = vaddq_u32(
+        vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1)), vdupq_n_u32(0x7fff));
+    uint32x4_t const quiet = vorrq_u32(bits, vdupq_n_u32(0x400000));
+    uint32x4_t const nan   = vmvnq_u32(vceqq_f32(value, value));
+    vst1_u16(dst + i,
+             vshrn_n_u32(vbslq_u32(nan, quiet, vaddq_u32(bits, bias)), 16));
+  }
+#endif
+  for (; i < n; ++i) dst[i] = float_to_bfloat16_bits(src[i]);
+}
+
+struct binary16_format {
+  static void widen(std::uint16_t const* src, float* dst, std::size_t n) {
+    convert_binary16_to_float(src, dst, n);
+  }
+  static void narrow(float const* src, std::uint16_t* dst, std::size_t n) {
+    convert_float_to_binary16(src, dst, n);
+  }
+};
+
+struct bfloat16_format {
+  static void widen(std::uint16_t const* src, float* dst, std::size_t n) {
+    convert_bfloat16_to_float(src, dst, n);
+  }
+  static void narrow(float const* src, std::uint16_t* dst, std::size_t n) {
+    convert_float_to_bfloat16(src, dst, n);
+  }
+};
+
+// the format of half_t or bhalf_t, unless they are float
+template <class T>
+using float16_format_t = std::conditional_t<
+    is_float16<T>::value, binary16_format,
+    std::conditional_t<is_bfloat16<T>::value, bfloat16_format, void>>;
+
+// The implementation of simd<half_t, Abi> and simd<bhalf_t, Abi>: float lanes
+// of simd<float, Abi>, converted to and from Format by copy_from and copy_to.
+template <class T, class Abi, class Format>
+class float16_simd {
+  static_assert(sizeof(T) == sizeof(std::uint16_t));
+
+ public:
+  using value_type = T;
+  using abi_type   = Abi;
+  using mask_type  = simd_mask<T, Abi>;
+  using float_type = simd<float, Abi>;
+
+ private:
+  using simd_type = simd<T, Abi>;
+
+  float_type m_value;
+
+ public:
+  class reference {
+    float& m_lane;
+
+   public:
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit reference(float& lane)
+        : m_lane(lane) {}
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator=(
+        value_type value) const {
+      m_lane = float(value);
+      return *this;
+    }
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION operator value_type() const {
+      return value_type(m_lane);
+    }
+  };
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return float_type::size();
+  }
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION float16_simd() = default;
+  template <class U, std::enable_if_t<std::is_convertible_v<U, value_type>,
+                                      bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION float16_simd(U&& value)
+      : m_value(float(value_type(std::forward<U>(value)))) {}
+  // the lanes are rounded to value_type when they are stored
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit float16_simd(
+      float_type const& value)
+      : m_value(value) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION float16_simd(G&& gen)
+      : m_value([&](auto lane) -> float {
+          return float(value_type(gen(lane)));
+        }) {}
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(m_value[i]);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return value_type(m_value[i]);
+  }
+
+  template <class Flags>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       Flags) {
+    float lanes[size()];
+    Format::widen(reinterpret_cast<std::uint16_t const*>(ptr), lanes, size());
+    m_value.copy_from(lanes, element_aligned_tag());
+  }
+  template <class Flags>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     Flags) const {
+    float lanes[size()];
+    m_value.copy_to(lanes, element_aligned_tag());
+    Format::narrow(lanes, reinterpret_cast<std::uint16_t*>(ptr), size());
+  }
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator float_type() const {
+    return m_value;
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_type
+  operator-() const noexcept {
+    return simd_type(-m_value);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator*(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return simd_type(lhs.m_value * rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator/(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return simd_type(lhs.m_value / rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator+(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return simd_type(lhs.m_value + rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  operator-(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return simd_type(lhs.m_value - rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return mask_type(lhs.m_value < rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return mask_type(lhs.m_value > rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return mask_type(lhs.m_value <= rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return mask_type(lhs.m_value >= rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return mask_type(lhs.m_value == rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd_type const& lhs, simd_type const& rhs) noexcept {
+    return mask_type(lhs.m_value != rhs.m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd_type
+  condition(mask_type const& mask, simd_type const& lhs,
+            simd_type const& rhs) {
+    return simd_type(condition(typename float_type::mask_type(mask),
+                               lhs.m_value, rhs.m_value));
+  }
+};
+
+// simd_mask of a float16_simd, for the Abis whose masks depend on the
+// element type
+template <class Abi>
+class float16_simd_mask : public simd_mask<float, Abi> {
+  using base_type = simd_mask<float, Abi>;
+
+ public:
+  using base_type::base_type;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION float16_simd_mask() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION float16_simd_mask(
+      base_type const& mask)
+      : base_type(mask) {}
+};
+
+}  // namespace Impl
+
+#define KOKKOS_IMPL_SIMD_FLOAT16(TYPE, FORMAT, ABI)             \
+  template <int N>                                              \
+  class simd<TYPE, ABI<N>>                                      \
+      : public Impl::float16_simd<TYPE, ABI<N>, FORMAT> {       \
+    using base_type = Impl::float16_simd<TYPE, ABI<N>, FORMAT>; \
+                                                                \
+   public:                                                      \
+    using base_type::base_type;                                 \
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd() = default;     \
+  };
+
+#define KOKKOS_IMPL_SIMD_FLOAT16_MASK(TYPE, ABI)                     \
+  template <>                                                        \
+  class simd_mask<TYPE, ABI> : public Impl::float16_simd_mask<ABI> { \
+    using base_type = Impl::float16_simd_mask<ABI>;                  \
+                                                                     \
+   public:                                                           \
+    using base_type::base_type;                                      \
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask() = default;     \
+    KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask(                 \
+        simd_mask<float, ABI> const& mask)                           \
+        : base_type(mask) {}                                         \
+  };
+
+// The packs of a 16-bit TYPE stored in FORMAT, for the host Abis. These macros
+// are left defined so that the unit tests can instantiate the packs where
+// half_t and bhalf_t are float.
+#if defined(KOKKOS_ARCH_AVX512XEON)
+#define KOKKOS_IMPL_SIMD_FLOAT16_AVX512(TYPE, FORMAT)                 \
+  KOKKOS_IMPL_SIMD_FLOAT16(TYPE, FORMAT, simd_abi::avx512_fixed_size)
+#else
+#define KOKKOS_IMPL_SIMD_FLOAT16_AVX512(TYPE, FORMAT)
+#endif
+#if defined(KOKKOS_ARCH_AVX2)
+#define KOKKOS_IMPL_SIMD_FLOAT16_AVX2(TYPE, FORMAT)                 \
+  KOKKOS_IMPL_SIMD_FLOAT16_MASK(TYPE, simd_abi::avx2_fixed_size<4>) \
+  KOKKOS_IMPL_SIMD_FLOAT16_MASK(TYPE, simd_abi::avx2_fixed_size<8>) \
+  KOKKOS_IMPL_SIMD_FLOAT16(TYPE, FORMAT, simd_abi::avx2_fixed_size)
+#else
+#define KOKKOS_IMPL_SIMD_FLOAT16_AVX2(TYPE, FORMAT)
+#endif
+#if defined(KOKKOS_ARCH_ARM_NEON)
+#define KOKKOS_IMPL_SIMD_FLOAT16_NEON(TYPE, FORMAT)                 \
+  KOKKOS_IMPL_SIMD_FLOAT16_MASK(TYPE, simd_abi::neon_fixed_size<2>) \
+  KOKKOS_IMPL_SIMD_FLOAT16_MASK(TYPE, simd_abi::neon_fixed_size<4>) \
+  KOKKOS_IMPL_SIMD_FLOAT16(TYPE, FORMAT, simd_abi::neon_fixed_size)
+#else
+#define KOKKOS_IMPL_SIMD_FLOAT16_NEON(TYPE, FORMAT)
+#endif
+#define KOKKOS_IMPL_SIMD_FLOAT16_HOST_ABIS(TYPE, FORMAT) \
+  KOKKOS_IMPL_SIMD_FLOAT16_AVX512(TYPE, FORMAT)          \
+  KOKKOS_IMPL_SIMD_FLOAT16_AVX2(TYPE, FORMAT)            \
+  KOKKOS_IMPL_SIMD_FLOAT16_NEON(TYPE, FORMAT)
+
+#if !KOKKOS_HALF_T_IS_FLOAT
+KOKKOS_IMPL_SIMD_FLOAT16_HOST_ABIS(half_t, Impl::binary16_format)
+#endif
+#if !KOKKOS_BHALF_T_IS_FLOAT
+KOKKOS_IMPL_SIMD_FLOAT16_HOST_ABIS(bhalf_t, Impl::bfloat16_format)
+#endif
+
+// Converts the rank 1 View src into dst, between half_t or bhalf_t and
+// float, in packs. Both Views must be contiguous and host accessible, and ex
+// a host execution space. Views of the same value type are deep copied.
+template <class ExecutionSpace, class DT, class... DP, class ST, class... SP>
+void convert_view(const ExecutionSpace& ex, const View<DT, DP...>& dst,
+                  const View<ST, SP...>& src) {
+  using dst_type   = View<DT, DP...>;
+  using src_type   = View<ST, SP...>;
+  using dst_value  = typename dst_type::non_const_value_type;
+  using src_value  = typename src_type::const_value_type;
+  using src_scalar = std::remove_const_t<src_value>;
+  static_assert(dst_type::rank == 1 && src_type::rank == 1,
+                "Kokkos::Experimental::convert_view: Views must be rank 1");
+  static_assert(std::is_same_v<typename dst_type::value_type, dst_value>,
+                "Kokkos::Experimental::convert_view: dst must not be const");
+  static_assert(
+      SpaceAccessibility<ExecutionSpace, HostSpace>::accessible &&
+          SpaceAccessibility<HostSpace,
+                             typename dst_type::memory_space>::accessible &&
+          SpaceAccessibility<HostSpace,
+                             typename src_type::memory_space>::accessible,
+      "Kokkos::Experimental::convert_view: requires a host execution space "
+      "and host accessible Views");
+
+  if constexpr (std::is_same_v<dst_value, src_scalar>) {
+    Kokkos::deep_copy(ex, dst, src);
+  } else {
+    constexpr bool widen = std::is_same_v<dst_value, float>;
+    using format_type = Impl::float16_format_t<
+        std::conditional_t<widen, src_scalar, dst_value>>;
+    static_assert((widen || std::is_same_v<src_scalar, float>) &&
+                      !std::is_void_v<format_type>,
+                  "Kokkos::Experimental::convert_view: converts between "
+                  "half_t or bhalf_t and float");
+
+    if (dst.extent(0) != src.extent(0)) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::convert_view: extents of dst (" +
+          std::to_string(dst.extent(0)) + ") and src (" +
+          std::to_string(src.extent(0)) + ") differ");
+    }
+    if (!dst.span_is_contiguous() || !src.span_is_contiguous()) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::Experimental::convert_view: Views must be contiguous");
+    }
+
+    constexpr std::size_t chunk = 4096;
+    std::size_t const n         = src.extent(0);
+    auto* const dst_ptr         = dst.data();
+    auto const* const src_ptr   = src.data();
+    Kokkos::parallel_for(
+        "Kokkos::Experimental::convert_view",
+        RangePolicy<ExecutionSpace, IndexType<std::size_t>>(
+            ex, 0, (n + chunk - 1) / chunk),
+        [=](std::size_t c) {
+          std::size_t const begin = c * chunk;
+          std::size_t const count = Kokkos::min(chunk, n - begin);
+          if constexpr (widen) {
+            format_type::widen(
+                reinterpret_cast<std::uint16_t const*>(src_ptr + begin),
+                dst_ptr + begin, count);
+          } else {
+            format_type::narrow(
+                src_ptr + begin,
+                reinterpret_cast<std::uint16_t*>(dst_ptr + begin), count);
+          }
+        });
+  }
+}
+
+template <class DT, class... DP, class ST, class... SP>
+void convert_view(const View<DT, DP...>& dst, const View<ST, SP...>& src) {
+  Kokkos::DefaultHostExecutionSpace ex;
+  convert_view(ex, dst, src);
+  ex.fence("Kokkos::Experimental::convert_view: fence after conversion");
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
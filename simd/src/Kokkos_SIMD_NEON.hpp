@@ -689,6 +689,34 @@ namespace Experimental {
                 static_cast<float64x2_t>(c)));
 }
 
+namespace Impl {
+
+// 2^n for integral n in [-1022, 1023]
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::neon_fixed_size<2>>
+    exp2_integral(simd<double, simd_abi::neon_fixed_size<2>> const& n) {
+  int64x2_t const biased =
+      vaddq_s64(vcvtq_s64_f64(static_cast<float64x2_t>(n)), vdupq_n_s64(1023));
+  return simd<double, simd_abi::neon_fixed_size<2>>(
+      vreinterpretq_f64_s64(vshlq_n_s64(biased, 52)));
+}
+
+// significand in [1, 2) and unbiased exponent of a positive normal x
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::neon_fixed_size<2>>
+    split_significand(simd<double, simd_abi::neon_fixed_size<2>> const& x,
+                      simd<double, simd_abi::neon_fixed_size<2>>& exponent) {
+  uint64x2_t const bits =
+      vreinterpretq_u64_f64(static_cast<float64x2_t>(x));
+  exponent = simd<double, simd_abi::neon_fixed_size<2>>(vsubq_f64(
+      vcvtq_f64_u64(vshrq_n_u64(bits, 52)), vdupq_n_f64(1023.0)));
+  return simd<double, simd_abi::neon_fixed_size<2>>(vreinterpretq_f64_u64(
+      vorrq_u64(vandq_u64(bits, vdupq_n_u64(0x000fffffffffffffULL)),
+                vreinterpretq_u64_f64(vdupq_n_f64(1.0)))));
+}
+
+}  // namespace Impl
+
 template <>
 class simd<float, simd_abi::neon_fixed_size<2>> {
   float32x2_t m_value;
@@ -1939,6 +1967,11 @@ class simd<std::uint64_t, simd_abi::neon_fixed_size<2>> {
     return simd(
         vorrq_u64(static_cast<uint64x2_t>(lhs), static_cast<uint64x2_t>(rhs)));
   }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator^(
+      simd const& lhs, simd const& rhs) noexcept {
+    return simd(
+        veorq_u64(static_cast<uint64x2_t>(lhs), static_cast<uint64x2_t>(rhs)));
+  }
   [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
   operator==(simd const& lhs, simd const& rhs) noexcept {
     return mask_type(
@@ -187,6 +187,10 @@ class simd<T, simd_abi::scalar> {
       simd const& lhs, simd const& rhs) noexcept {
     return lhs.m_value | rhs.m_value;
   }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr simd operator^(
+      simd const& lhs, simd const& rhs) noexcept {
+    return lhs.m_value ^ rhs.m_value;
+  }
   [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr mask_type
   operator<(simd const& lhs, simd const& rhs) noexcept {
     return mask_type(lhs.m_value < rhs.m_value);
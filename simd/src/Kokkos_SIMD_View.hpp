@@ -0,0 +1,200 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_VIEW_HPP
+#define KOKKOS_SIMD_VIEW_HPP
+
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+// Accesses a rank 1 or rank 2 View in packs of simd_type::size() elements of
+// its last dimension: pack p of a rank 1 view holds v(p * width + lane), pack
+// (i, p) of a rank 2 view holds v(i, p * width + lane). Lanes past the end of
+// the last dimension read as zero and are not written.
+//
+// The access is chosen once from the runtime strides. Packs of a unit stride
+// dimension are plain vector loads and stores, aligned ones if the data and
+// the leading stride are multiples of the simd alignment (which a View
+// allocated with Kokkos::AllowPadding provides for rank 2), masked at the
+// tail. Other strides use the gather and scatter of the Abi.
+template <class ViewType, class Abi>
+class simd_view_adaptor {
+  static_assert(Kokkos::is_view_v<ViewType>,
+                "simd_view_adaptor: ViewType must be a Kokkos::View");
+  static_assert(ViewType::rank == 1 || ViewType::rank == 2,
+                "simd_view_adaptor: only rank 1 and 2 Views are supported");
+
+ public:
+  using view_type  = ViewType;
+  using value_type = typename ViewType::non_const_value_type;
+  using abi_type   = Abi;
+  using simd_type  = simd<value_type, Abi>;
+  using mask_type  = typename simd_type::mask_type;
+
+ private:
+  using index_type = simd<std::int32_t, Abi>;
+
+  view_type m_view;
+  std::size_t m_extent;  // of the vectorized dimension
+  std::size_t m_stride;  // of the vectorized dimension
+  bool m_aligned;
+  bool m_gather;
+
+  KOKKOS_FORCEINLINE_FUNCTION typename view_type::pointer_type impl_pointer(
+      std::size_t i, std::size_t pack) const {
+    std::size_t offset = pack * simd_type::size() * m_stride;
+    if constexpr (view_type::rank == 2) offset += i * m_view.stride(0);
+    return m_view.data() + offset;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION std::size_t impl_lanes(std::size_t pack) const {
+    std::size_t const first = pack * simd_type::size();
+    return Kokkos::min(m_extent - first, simd_type::size());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION index_type impl_index() const {
+    return index_type([&](std::size_t lane) {
+      return std::int32_t(lane * m_stride);
+    });
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION simd_type impl_load(std::size_t i,
+                                                  std::size_t pack) const {
+    value_type const* ptr   = impl_pointer(i, pack);
+    std::size_t const lanes = impl_lanes(pack);
+    simd_type result(value_type(0));
+    if (m_stride == 1 && lanes == simd_type::size()) {
+      if (m_aligned) {
+        result.copy_from(ptr, simd_flag_aligned);
+      } else {
+        result.copy_from(ptr, simd_flag_default);
+      }
+    } else if (m_stride == 1) {
+      where(mask(pack), result).copy_from(ptr, simd_flag_default);
+    } else if (m_gather) {
+      where(mask(pack), result).gather_from(ptr, impl_index());
+    } else {
+      for (std::size_t lane = 0; lane < lanes; ++lane) {
+        result[lane] = ptr[lane * m_stride];
+      }
+    }
+    return result;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void impl_store(std::size_t i, std::size_t pack,
+                                              simd_type const& value) const {
+    static_assert(!std::is_const_v<typename view_type::value_type>,
+                  "simd_view_adaptor: cannot store into a View of const");
+    value_type* ptr         = impl_pointer(i, pack);
+    std::size_t const lanes = impl_lanes(pack);
+    if (m_stride == 1 && lanes == simd_type::size()) {
+      if (m_aligned) {
+        value.copy_to(ptr, simd_flag_aligned);
+      } else {
+        value.copy_to(ptr, simd_flag_default);
+      }
+    } else if (m_stride == 1) {
+      where(mask(pack), value).copy_to(ptr, simd_flag_default);
+    } else if (m_gather) {
+      where(mask(pack), value).scatter_to(ptr, impl_index());
+    } else {
+      for (std::size_t lane = 0; lane < lanes; ++lane) {
+        ptr[lane * m_stride] = value[lane];
+      }
+    }
+  }
+
+ public:
+  simd_view_adaptor() = default;
+
+  KOKKOS_FUNCTION explicit simd_view_adaptor(view_type const& view)
+      : m_view(view),
+        m_extent(view.extent(view_type::rank - 1)),
+        m_stride(view.stride(view_type::rank - 1)) {
+    std::size_t const alignment = alignof(simd_type);
+    m_aligned = reinterpret_cast<std::uintptr_t>(view.data()) % alignment == 0;
+    if constexpr (view_type::rank == 2) {
+      m_aligned = m_aligned &&
+                  (view.stride(0) * sizeof(value_type)) % alignment == 0;
+    }
+    // the gather indices lane * stride are 32 bit
+    m_gather = m_stride * (simd_type::size() - 1) <= std::size_t(INT_MAX);
+  }
+
+  // number of packs in the vectorized dimension
+  KOKKOS_FUNCTION std::size_t size() const {
+    return (m_extent + simd_type::size() - 1) / simd_type::size();
+  }
+
+  KOKKOS_FUNCTION std::size_t extent(int r) const {
+    return r == int(view_type::rank) - 1 ? size() : m_view.extent(r);
+  }
+
+  KOKKOS_FUNCTION view_type const& view() const { return m_view; }
+
+  // lanes of the pack that lie within the View
+  KOKKOS_FORCEINLINE_FUNCTION mask_type mask(std::size_t pack) const {
+    std::size_t const lanes = impl_lanes(pack);
+    return mask_type([&](std::size_t lane) { return lane < lanes; });
+  }
+
+  template <class V = view_type, std::enable_if_t<V::rank == 1, bool> = false>
+  KOKKOS_FORCEINLINE_FUNCTION simd_type operator()(std::size_t pack) const {
+    return impl_load(0, pack);
+  }
+
+  template <class V = view_type, std::enable_if_t<V::rank == 2, bool> = false>
+  KOKKOS_FORCEINLINE_FUNCTION simd_type operator()(std::size_t i,
+                                                   std::size_t pack) const {
+    return impl_load(i, pack);
+  }
+
+  template <class V = view_type, std::enable_if_t<V::rank == 1, bool> = false>
+  KOKKOS_FORCEINLINE_FUNCTION void store(std::size_t pack,
+                                         simd_type const& value) const {
+    impl_store(0, pack, value);
+  }
+
+  template <class V = view_type, std::enable_if_t<V::rank == 2, bool> = false>
+  KOKKOS_FORCEINLINE_FUNCTION void store(std::size_t i, std::size_t pack,
+                                         simd_type const& value) const {
+    impl_store(i, pack, value);
+  }
+};
+
+template <class Abi, class ViewType>
+KOKKOS_FUNCTION simd_view_adaptor<ViewType, Abi> simd_view(
+    ViewType const& view) {
+  return simd_view_adaptor<ViewType, Abi>(view);
+}
+
+template <class ViewType>
+KOKKOS_FUNCTION simd_view_adaptor<
+    ViewType, simd_abi::native<typename ViewType::non_const_value_type>>
+simd_view(ViewType const& view) {
+  return simd_view_adaptor<
+      ViewType, simd_abi::native<typename ViewType::non_const_value_type>>(
+      view);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#endif
@@ -19,7 +19,10 @@
 #include <TestSIMD_Conversions.hpp>
 #include <TestSIMD_ShiftOps.hpp>
 #include <TestSIMD_Condition.hpp>
+#include <TestSIMD_Comparisons.hpp>
 #include <TestSIMD_GeneratorCtors.hpp>
 #include <TestSIMD_WhereExpressions.hpp>
 #include <TestSIMD_Reductions.hpp>
 #include <TestSIMD_Construction.hpp>
+#include <TestSIMD_View.hpp>
+#include <TestSIMD_Half.hpp>
@@ -0,0 +1,78 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_SIMD_COMPARISONS_HPP
+#define KOKKOS_TEST_SIMD_COMPARISONS_HPP
+
+#include <Kokkos_SIMD.hpp>
+#include <SIMDTesting_Utilities.hpp>
+
+template <typename Abi, typename DataType>
+inline void host_check_comparisons() {
+  if constexpr (is_type_v<Kokkos::Experimental::simd<DataType, Abi>>) {
+    using simd_type             = Kokkos::Experimental::simd<DataType, Abi>;
+    constexpr std::size_t lanes = simd_type::size();
+
+    // every third lane of b is less than, equal to or greater than a
+    DataType a_values[lanes];
+    DataType b_values[lanes];
+    for (std::size_t i = 0; i < lanes; ++i) {
+      a_values[i] = DataType(2 * i + 1);
+      b_values[i] = DataType(2 * i + i % 3);
+    }
+
+    simd_type a;
+    simd_type b;
+    a.copy_from(a_values, Kokkos::Experimental::simd_flag_default);
+    b.copy_from(b_values, Kokkos::Experimental::simd_flag_default);
+
+    auto const less          = a < b;
+    auto const less_equal    = a <= b;
+    auto const greater       = a > b;
+    auto const greater_equal = a >= b;
+    auto const equal         = a == b;
+    auto const not_equal     = a != b;
+    for (std::size_t i = 0; i < lanes; ++i) {
+      DataType const x = a_values[i];
+      DataType const y = b_values[i];
+      EXPECT_EQ(bool(less[i]), x < y) << i;
+      EXPECT_EQ(bool(less_equal[i]), x <= y) << i;
+      EXPECT_EQ(bool(greater[i]), x > y) << i;
+      EXPECT_EQ(bool(greater_equal[i]), x >= y) << i;
+      EXPECT_EQ(bool(equal[i]), x == y) << i;
+      EXPECT_EQ(bool(not_equal[i]), x != y) << i;
+    }
+  }
+}
+
+template <typename Abi, typename... DataTypes>
+inline void host_check_comparisons_all_types(
+    Kokkos::Experimental::Impl::data_types<DataTypes...>) {
+  (host_check_comparisons<Abi, DataTypes>(), ...);
+}
+
+template <typename... Abis>
+inline void host_check_comparisons_all_abis(
+    Kokkos::Experimental::Impl::abi_set<Abis...>) {
+  using DataTypes = Kokkos::Experimental::Impl::data_type_set;
+  (host_check_comparisons_all_types<Abis>(DataTypes()), ...);
+}
+
+TEST(simd, host_comparisons) {
+  host_check_comparisons_all_abis(Kokkos::Experimental::Impl::host_abi_set());
+}
+
+#endif
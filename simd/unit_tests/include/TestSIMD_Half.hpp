@@ -0,0 +1,232 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_SIMD_HALF_HPP
+#define KOKKOS_TEST_SIMD_HALF_HPP
+
+#include <Kokkos_SIMD.hpp>
+#include <SIMDTesting_Utilities.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// floats of every exponent, the ties between neighbouring 16-bit values, and
+// the limits of both formats
+inline std::vector<float> half_conversion_inputs() {
+  std::vector<float> inputs;
+  for (std::uint64_t bits = 0; bits <= 0xffffffffu; bits += 4099) {
+    inputs.push_back(Kokkos::bit_cast<float>(std::uint32_t(bits)));
+  }
+  for (std::uint32_t bits : {0x00000000u, 0x80000000u, 0x3f800000u, 0x477fe000u,
+                             0x477fefffu, 0x477ff000u, 0x33000000u, 0x33000001u,
+                             0x33c00000u, 0x387fc000u, 0x387fe000u, 0x38800000u,
+                             0x3f801000u, 0x3f803000u, 0x3f808000u, 0x3f818000u,
+                             0x7f7fffffu, 0x7f800000u, 0xff800000u, 0x7fc00000u,
+                             0x7f800001u, 0xffc12345u}) {
+    inputs.push_back(Kokkos::bit_cast<float>(bits));
+  }
+  return inputs;
+}
+
+TEST(simd, half_scalar_conversions) {
+  using namespace Kokkos::Experimental::Impl;
+  EXPECT_EQ(float_to_binary16_bits(1.0f), 0x3c00);
+  EXPECT_EQ(float_to_binary16_bits(-2.0f), 0xc000);
+  EXPECT_EQ(float_to_binary16_bits(65504.0f), 0x7bff);
+  EXPECT_EQ(float_to_binary16_bits(65519.0f), 0x7bff);
+  EXPECT_EQ(float_to_binary16_bits(65520.0f), 0x7c00);
+  EXPECT_EQ(float_to_binary16_bits(0x1p-24f), 0x0001);
+  EXPECT_EQ(float_to_binary16_bits(0x1p-25f), 0x0000);
+  EXPECT_EQ(float_to_binary16_bits(0x1.8p-24f), 0x0002);
+  EXPECT_EQ(float_to_binary16_bits(0x1.ff8p-15f), 0x03ff);
+  EXPECT_EQ(float_to_binary16_bits(0x1.ffcp-15f), 0x0400);
+  EXPECT_EQ(float_to_binary16_bits(1.0f + 0x1p-11f), 0x3c00);
+  EXPECT_EQ(float_to_binary16_bits(1.0f + 0x3p-11f), 0x3c02);
+  EXPECT_EQ(binary16_bits_to_float(0x3555), 0x1.554p-2f);
+  EXPECT_EQ(binary16_bits_to_float(0x8001), -0x1p-24f);
+  EXPECT_EQ(binary16_bits_to_float(0xfc00),
+            -Kokkos::Experimental::infinity_v<float>);
+
+  EXPECT_EQ(float_to_bfloat16_bits(1.0f), 0x3f80);
+  EXPECT_EQ(float_to_bfloat16_bits(1.0f + 0x1p-8f), 0x3f80);
+  EXPECT_EQ(float_to_bfloat16_bits(1.0f + 0x3p-8f), 0x3f82);
+  EXPECT_EQ(float_to_bfloat16_bits(0x1.fffffep127f), 0x7f80);
+  EXPECT_EQ(float_to_bfloat16_bits(Kokkos::bit_cast<float>(0x7f800001u)),
+            0x7fc0);
+  EXPECT_EQ(bfloat16_bits_to_float(0xc0a0), -5.0f);
+
+  // every binary16 value survives the round trip
+  for (std::uint32_t bits = 0; bits <= 0xffffu; ++bits) {
+    float const value = binary16_bits_to_float(std::uint16_t(bits));
+    if (value == value) {
+      EXPECT_EQ(float_to_binary16_bits(value), bits);
+    } else {
+      EXPECT_EQ(float_to_binary16_bits(value), bits | 0x0200);
+    }
+  }
+
+#if !KOKKOS_HALF_T_IS_FLOAT
+  for (float value : half_conversion_inputs()) {
+    if (value != value) continue;
+    EXPECT_EQ(Kokkos::bit_cast<std::uint16_t>(
+                  Kokkos::Experimental::cast_to_half(value)),
+              float_to_binary16_bits(value))
+        << value;
+  }
+#endif
+}
+
+TEST(simd, half_bulk_conversions) {
+  using namespace Kokkos::Experimental::Impl;
+  std::vector<std::uint16_t> all(0x10000);
+  for (std::uint32_t bits = 0; bits <= 0xffffu; ++bits) {
+    all[bits] = std::uint16_t(bits);
+  }
+  std::vector<float> wide(all.size());
+  convert_binary16_to_float(all.data(), wide.data(), all.size());
+  for (std::uint32_t bits = 0; bits <= 0xffffu; ++bits) {
+    EXPECT_EQ(Kokkos::bit_cast<std::uint32_t>(wide[bits]),
+              Kokkos::bit_cast<std::uint32_t>(
+                  binary16_bits_to_float(std::uint16_t(bits))))
+        << bits;
+  }
+  convert_bfloat16_to_float(all.data(), wide.data(), all.size());
+  for (std::uint32_t bits = 0; bits <= 0xffffu; ++bits) {
+    EXPECT_EQ(Kokkos::bit_cast<std::uint32_t>(wide[bits]),
+              Kokkos::bit_cast<std::uint32_t>(
+                  bfloat16_bits_to_float(std::uint16_t(bits))))
+        << bits;
+  }
+
+  std::vector<float> const inputs = half_conversion_inputs();
+  std::vector<std::uint16_t> narrow(inputs.size());
+  convert_float_to_binary16(inputs.data(), narrow.data(), inputs.size());
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    EXPECT_EQ(narrow[i], float_to_binary16_bits(inputs[i])) << inputs[i];
+  }
+  convert_float_to_bfloat16(inputs.data(), narrow.data(), inputs.size());
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    EXPECT_EQ(narrow[i], float_to_bfloat16_bits(inputs[i])) << inputs[i];
+  }
+}
+
+template <class HalfType>
+inline void host_check_convert_view() {
+  std::size_t const n = 10007;
+  Kokkos::View<float*, Kokkos::HostSpace> values("values", n);
+  Kokkos::View<HalfType*, Kokkos::HostSpace> packed("packed", n);
+  Kokkos::View<float*, Kokkos::HostSpace> round_trip("round_trip", n);
+  for (std::size_t i = 0; i < n; ++i) {
+    values(i) = float(int(i) - 5000) / 64.0f;  // exact in both formats
+  }
+  Kokkos::Experimental::convert_view(packed, values);
+  Kokkos::Experimental::convert_view(round_trip, packed);
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(round_trip(i), values(i)) << i;
+  }
+}
+
+TEST(simd, half_convert_view) {
+  host_check_convert_view<Kokkos::Experimental::half_t>();
+  host_check_convert_view<Kokkos::Experimental::bhalf_t>();
+}
+
+// A 16-bit type stored in Format. It stands in for half_t and bhalf_t, so
+// that their packs are also instantiated where those types are float.
+template <class Format>
+struct test_float16 {
+  std::uint16_t bits;
+
+  test_float16() = default;
+  test_float16(float value) { Format::narrow(&value, &bits, 1); }
+  explicit operator float() const {
+    float value;
+    Format::widen(&bits, &value, 1);
+    return value;
+  }
+};
+
+using test_binary16 =
+    test_float16<Kokkos::Experimental::Impl::binary16_format>;
+using test_bfloat16 =
+    test_float16<Kokkos::Experimental::Impl::bfloat16_format>;
+
+namespace Kokkos::Experimental {
+KOKKOS_IMPL_SIMD_FLOAT16_HOST_ABIS(test_binary16, Impl::binary16_format)
+KOKKOS_IMPL_SIMD_FLOAT16_HOST_ABIS(test_bfloat16, Impl::bfloat16_format)
+}  // namespace Kokkos::Experimental
+
+// packs of 16-bit types compute in float and round when they are stored
+template <typename Abi, typename HalfType>
+inline void host_check_half_simd() {
+  if constexpr (!std::is_same_v<Abi, Kokkos::Experimental::simd_abi::scalar> &&
+                is_type_v<Kokkos::Experimental::simd<HalfType, Abi>>) {
+    using simd_type             = Kokkos::Experimental::simd<HalfType, Abi>;
+    using float_type            = typename simd_type::float_type;
+    constexpr std::size_t width = simd_type::size();
+    HalfType lhs[width];
+    HalfType rhs[width];
+    HalfType result[width];
+    for (std::size_t lane = 0; lane < width; ++lane) {
+      lhs[lane] = HalfType(1.0f / float(lane + 3));
+      rhs[lane] = HalfType(float(lane) - 1.5f);
+    }
+    simd_type a;
+    simd_type b;
+    a.copy_from(lhs, Kokkos::Experimental::simd_flag_default);
+    b.copy_from(rhs, Kokkos::Experimental::simd_flag_default);
+    ((a + b) * a / b - a).copy_to(result,
+                                  Kokkos::Experimental::simd_flag_default);
+    auto const less = a < b;
+    for (std::size_t lane = 0; lane < width; ++lane) {
+      float const x         = float(lhs[lane]);
+      float const y         = float(rhs[lane]);
+      HalfType const loaded = a[lane];
+      EXPECT_EQ(float(loaded), x);
+      EXPECT_EQ(float(result[lane]), float(HalfType((x + y) * x / y - x)));
+      EXPECT_EQ(bool(less[lane]), x < y);
+    }
+
+    condition(less, a, b).copy_to(result,
+                                  Kokkos::Experimental::simd_flag_default);
+    for (std::size_t lane = 0; lane < width; ++lane) {
+      EXPECT_EQ(float(result[lane]), float(less[lane] ? lhs[lane] : rhs[lane]));
+    }
+
+    simd_type(float_type(1.0f / 3.0f))
+        .copy_to(result, Kokkos::Experimental::simd_flag_default);
+    EXPECT_EQ(float(result[width - 1]), float(HalfType(1.0f / 3.0f)));
+  }
+}
+
+template <typename... Abis>
+inline void host_check_half_simd_all_abis(
+    Kokkos::Experimental::Impl::abi_set<Abis...>) {
+  (host_check_half_simd<Abis, test_binary16>(), ...);
+  (host_check_half_simd<Abis, test_bfloat16>(), ...);
+#if !KOKKOS_HALF_T_IS_FLOAT
+  (host_check_half_simd<Abis, Kokkos::Experimental::half_t>(), ...);
+#endif
+#if !KOKKOS_BHALF_T_IS_FLOAT
+  (host_check_half_simd<Abis, Kokkos::Experimental::bhalf_t>(), ...);
+#endif
+}
+
+TEST(simd, host_half_packs) {
+  host_check_half_simd_all_abis(Kokkos::Experimental::Impl::host_abi_set());
+}
+
+#endif
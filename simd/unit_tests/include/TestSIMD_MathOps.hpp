@@ -166,6 +166,86 @@ inline void host_check_math_ops_all_abis(
   (host_check_math_ops_all_types<Abis>(DataTypes()), ...);
 }
 
+// the vectorized <cmath> kernels are not bit-identical to the scalar
+// functions, so compare them within a few ULP (the reference itself is only
+// faithfully rounded) and require the special values to match exactly
+template <typename Abi, typename SimdOp, typename ScalarOp>
+inline void host_check_cmath_op(SimdOp simd_op, ScalarOp scalar_op,
+                                double lower, double upper) {
+  using simd_type             = Kokkos::Experimental::simd<double, Abi>;
+  constexpr std::size_t width = simd_type::size();
+  constexpr int n             = 1000;
+  for (int i = 0; i < n; i += width) {
+    simd_type const arg([&](std::size_t lane) {
+      return lower + (upper - lower) * double(i + lane) / n;
+    });
+    simd_type const computed = simd_op(arg);
+    for (std::size_t lane = 0; lane < width; ++lane) {
+      double const expected = scalar_op(arg[lane]);
+      if (Kokkos::isfinite(expected)) {
+        EXPECT_NEAR(computed[lane], expected,
+                    4 * Kokkos::Experimental::epsilon_v<double> *
+                        Kokkos::abs(expected))
+            << "at " << arg[lane];
+      } else if (Kokkos::isnan(expected)) {
+        EXPECT_TRUE(Kokkos::isnan(computed[lane])) << "at " << arg[lane];
+      } else {
+        EXPECT_EQ(computed[lane], expected) << "at " << arg[lane];
+      }
+    }
+  }
+  double const inf = Kokkos::Experimental::infinity_v<double>;
+  for (double special : {0.0, -0.0, inf, -inf,
+                         Kokkos::Experimental::quiet_NaN_v<double>}) {
+    double const computed = simd_op(simd_type(special))[0];
+    double const expected = scalar_op(special);
+    if (Kokkos::isnan(expected)) {
+      EXPECT_TRUE(Kokkos::isnan(computed)) << "at " << special;
+    } else {
+      EXPECT_EQ(computed, expected) << "at " << special;
+      EXPECT_EQ(Kokkos::signbit(computed), Kokkos::signbit(expected))
+          << "at " << special;
+    }
+  }
+}
+
+template <typename Abi>
+inline void host_check_cmath_ops() {
+  if constexpr (is_type_v<Kokkos::Experimental::simd<double, Abi>>) {
+#define KOKKOS_IMPL_TEST_CMATH_OP(FUNC, LOWER, UPPER)                    \
+  host_check_cmath_op<Abi>([](auto const& x) { return Kokkos::FUNC(x); }, \
+                           [](double x) { return std::FUNC(x); }, LOWER, \
+                           UPPER)
+    KOKKOS_IMPL_TEST_CMATH_OP(exp, -745.0, 709.0);
+    KOKKOS_IMPL_TEST_CMATH_OP(exp2, -1074.0, 1023.0);
+    KOKKOS_IMPL_TEST_CMATH_OP(log, 1e-300, 1e300);
+    KOKKOS_IMPL_TEST_CMATH_OP(log, 0.25, 4.0);
+    KOKKOS_IMPL_TEST_CMATH_OP(log2, 0.25, 4.0);
+    KOKKOS_IMPL_TEST_CMATH_OP(log10, 0.25, 4.0);
+    KOKKOS_IMPL_TEST_CMATH_OP(sin, -100.0, 100.0);
+    KOKKOS_IMPL_TEST_CMATH_OP(sin, -2e6, 2e6);
+    KOKKOS_IMPL_TEST_CMATH_OP(cos, -100.0, 100.0);
+    KOKKOS_IMPL_TEST_CMATH_OP(cos, -2e6, 2e6);
+    KOKKOS_IMPL_TEST_CMATH_OP(tanh, -25.0, 25.0);
+    KOKKOS_IMPL_TEST_CMATH_OP(tanh, -1.0, 1.0);
+    KOKKOS_IMPL_TEST_CMATH_OP(erf, -7.0, 7.0);
+#undef KOKKOS_IMPL_TEST_CMATH_OP
+    for (double y : {-3.5, -1.0, 0.5, 2.0, 3.0, 17.25}) {
+      host_check_cmath_op<Abi>(
+          [&](auto const& x) {
+            return Kokkos::pow(x, Kokkos::Experimental::simd<double, Abi>(y));
+          },
+          [&](double x) { return std::pow(x, y); }, -30.0, 30.0);
+    }
+  }
+}
+
+template <typename... Abis>
+inline void host_check_cmath_ops_all_abis(
+    Kokkos::Experimental::Impl::abi_set<Abis...>) {
+  (host_check_cmath_ops<Abis>(), ...);
+}
+
 template <typename Abi, typename Loader, typename BinaryOp, typename T>
 KOKKOS_INLINE_FUNCTION void device_check_math_op_one_loader(
     BinaryOp binary_op, std::size_t n, T const* first_args,
@@ -310,6 +390,10 @@ TEST(simd, host_math_ops) {
   host_check_math_ops_all_abis(Kokkos::Experimental::Impl::host_abi_set());
 }
 
+TEST(simd, host_cmath_ops) {
+  host_check_cmath_ops_all_abis(Kokkos::Experimental::Impl::host_abi_set());
+}
+
 TEST(simd, device_math_ops) {
 #ifdef KOKKOS_ENABLE_OPENMPTARGET  // FIXME_OPENMPTARGET
   GTEST_SKIP()
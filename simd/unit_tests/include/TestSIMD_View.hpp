@@ -0,0 +1,118 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_TEST_SIMD_VIEW_HPP
+#define KOKKOS_TEST_SIMD_VIEW_HPP
+
+#include <Kokkos_SIMD.hpp>
+#include <SIMDTesting_Utilities.hpp>
+
+// loads every pack of the last dimension, checks it against the View, and
+// stores it back incremented by one
+template <typename Abi, typename ViewType>
+inline void host_check_simd_view_access(ViewType const& view) {
+  using value_type = typename ViewType::non_const_value_type;
+  auto const at    = [&](std::size_t i, std::size_t j) -> value_type& {
+    if constexpr (ViewType::rank == 1) {
+      return view(j);
+    } else {
+      return view(i, j);
+    }
+  };
+  std::size_t const rows   = ViewType::rank == 1 ? 1 : view.extent(0);
+  std::size_t const extent = view.extent(ViewType::rank - 1);
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < extent; ++j) {
+      at(i, j) = value_type(1 + (i * extent + j) % 100);
+    }
+  }
+
+  auto const simd_view = Kokkos::Experimental::simd_view<Abi>(view);
+  using simd_type      = typename decltype(simd_view)::simd_type;
+  constexpr std::size_t width = simd_type::size();
+  ASSERT_EQ(simd_view.size(), (extent + width - 1) / width);
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t pack = 0; pack < simd_view.size(); ++pack) {
+      simd_type value;
+      if constexpr (ViewType::rank == 1) {
+        value = simd_view(pack);
+      } else {
+        value = simd_view(i, pack);
+      }
+      for (std::size_t lane = 0; lane < width; ++lane) {
+        std::size_t const j = pack * width + lane;
+        EXPECT_EQ(value[lane], j < extent ? at(i, j) : value_type(0))
+            << "at " << i << ", " << j;
+      }
+      if constexpr (ViewType::rank == 1) {
+        simd_view.store(pack, value + simd_type(1));
+      } else {
+        simd_view.store(i, pack, value + simd_type(1));
+      }
+    }
+  }
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < extent; ++j) {
+      EXPECT_EQ(at(i, j), value_type(2 + (i * extent + j) % 100))
+          << "at " << i << ", " << j;
+    }
+  }
+}
+
+template <typename Abi, typename DataType>
+inline void host_check_simd_view() {
+  if constexpr (is_type_v<Kokkos::Experimental::simd<DataType, Abi>>) {
+    using Kokkos::HostSpace;
+    // contiguous, with a partial last pack
+    Kokkos::View<DataType*, HostSpace> contiguous("contiguous", 19);
+    host_check_simd_view_access<Abi>(contiguous);
+    // strided, gathered
+    Kokkos::View<DataType**, Kokkos::LayoutRight, HostSpace> columns(
+        "columns", 19, 3);
+    host_check_simd_view_access<Abi>(
+        Kokkos::subview(columns, Kokkos::ALL, 1));
+    // rows of padded rank 2 Views, contiguous or strided
+    Kokkos::View<DataType**, Kokkos::LayoutRight, HostSpace> right(
+        Kokkos::view_alloc("right", Kokkos::AllowPadding), 5, 13);
+    host_check_simd_view_access<Abi>(right);
+    Kokkos::View<DataType**, Kokkos::LayoutLeft, HostSpace> left(
+        Kokkos::view_alloc("left", Kokkos::AllowPadding), 5, 13);
+    host_check_simd_view_access<Abi>(left);
+    // read-only access
+    Kokkos::View<DataType const*, HostSpace> const_view = contiguous;
+    auto const simd_view = Kokkos::Experimental::simd_view<Abi>(const_view);
+    EXPECT_EQ(simd_view(0)[0], DataType(2));
+  }
+}
+
+template <typename Abi, typename... DataTypes>
+inline void host_check_simd_view_all_types(
+    Kokkos::Experimental::Impl::data_types<DataTypes...>) {
+  (host_check_simd_view<Abi, DataTypes>(), ...);
+}
+
+template <typename... Abis>
+inline void host_check_simd_view_all_abis(
+    Kokkos::Experimental::Impl::abi_set<Abis...>) {
+  using DataTypes = Kokkos::Experimental::Impl::data_type_set;
+  (host_check_simd_view_all_types<Abis>(DataTypes()), ...);
+}
+
+TEST(simd, host_view_access) {
+  host_check_simd_view_all_abis(Kokkos::Experimental::Impl::host_abi_set());
+}
+
+#endif
@@ -12,6 +12,7 @@ SPDX-License-Identifier: (BSD-3-Clause)
 #include <desul/atomics/Common.hpp>
 #include <desul/atomics/Lock_Array.hpp>
 #include <desul/atomics/Thread_Fence_GCC.hpp>
+#include <cstring>
 #include <type_traits>
 
 namespace desul {
@@ -30,6 +31,53 @@ struct host_atomic_exchange_available_gcc {
       std::is_trivially_copyable<T>::value;
 };
 
+// 16-byte types are not lock-free in general, but when the target has a 16-byte
+// compare-and-swap (cmpxchg16b with -mcx16, or the aarch64 exclusive pair) the
+// host fallback uses it instead of the lock array. Where
+// DESUL_HAVE_16BYTE_COMPARE_AND_SWAP is defined these types are lock-free
+// already and this path is not used.
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) && defined(__SIZEOF_INT128__) && \
+    !defined(DESUL_HAVE_16BYTE_COMPARE_AND_SWAP)
+#define DESUL_IMPL_HAVE_HOST_COMPARE_AND_SWAP_16
+#endif
+
+template <class T>
+struct host_atomic_cas16_available_gcc {
+  constexpr static bool value =
+#ifdef DESUL_IMPL_HAVE_HOST_COMPARE_AND_SWAP_16
+      !host_atomic_exchange_available_gcc<T>::value && sizeof(T) == 16 &&
+      alignof(T) == 16 && std::is_trivially_copyable<T>::value;
+#else
+      false;
+#endif
+};
+
+#ifdef DESUL_IMPL_HAVE_HOST_COMPARE_AND_SWAP_16
+// __extension__ keeps -Wpedantic quiet about the non-standard type
+__extension__ typedef unsigned __int128 host_cas16_word_gcc;
+
+template <class T>
+std::enable_if_t<host_atomic_cas16_available_gcc<T>::value, T> host_atomic_cas16_gcc(
+    T* const dest, T compare, T value) {
+  host_cas16_word_gcc expected;
+  host_cas16_word_gcc desired;
+  std::memcpy(&expected, &compare, sizeof(T));
+  std::memcpy(&desired, &value, sizeof(T));
+  // the legacy builtin is a full barrier and, unlike __atomic_compare_exchange,
+  // is expanded inline instead of calling into libatomic
+  host_cas16_word_gcc const old = __sync_val_compare_and_swap(
+      reinterpret_cast<host_cas16_word_gcc*>(dest), expected, desired);
+  T return_val;
+  std::memcpy(static_cast<void*>(&return_val), &old, sizeof(T));
+  return return_val;
+}
+
+template <class T>
+bool host_atomic_cas16_same_bits_gcc(const T& lhs, const T& rhs) {
+  return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+#endif
+
 // clang-format off
 // Disable warning for large atomics on clang 7 and up (checked with godbolt)
 // error: large atomic operation may incur significant performance penalty [-Werror,-Watomic-alignment]
@@ -80,16 +128,45 @@ host_atomic_compare_exchange(
   return compare;
 }
 
+#ifdef DESUL_IMPL_HAVE_HOST_COMPARE_AND_SWAP_16
+template <class T, class MemoryOrder, class MemoryScope>
+std::enable_if_t<host_atomic_cas16_available_gcc<T>::value, T> host_atomic_exchange(
+    T* const dest,
+    dont_deduce_this_parameter_t<const T> val,
+    MemoryOrder /*order*/,
+    MemoryScope /*scope*/) {
+  // a torn read only costs one more iteration
+  T assume = *dest;
+  T oldval = host_atomic_cas16_gcc(dest, assume, val);
+  while (!host_atomic_cas16_same_bits_gcc(assume, oldval)) {
+    assume = oldval;
+    oldval = host_atomic_cas16_gcc(dest, assume, val);
+  }
+  return oldval;
+}
+
+template <class T, class MemoryOrder, class MemoryScope>
+std::enable_if_t<host_atomic_cas16_available_gcc<T>::value, T>
+host_atomic_compare_exchange(T* const dest,
+                             dont_deduce_this_parameter_t<const T> compare,
+                             dont_deduce_this_parameter_t<const T> val,
+                             MemoryOrder /*order*/,
+                             MemoryScope /*scope*/) {
+  return host_atomic_cas16_gcc(dest, compare, val);
+}
+#endif
+
 template <class T, class MemoryOrder, class MemoryScope>
-std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value, T> host_atomic_exchange(
+std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value &&
+                     !host_atomic_cas16_available_gcc<T>::value,
+                 T>
+host_atomic_exchange(
     T* const dest,
     dont_deduce_this_parameter_t<const T> val,
     MemoryOrder /*order*/,
     MemoryScope scope) {
   // Acquire a lock for the address
-  // clang-format off
-  while (!lock_address((void*)dest, scope)) {}
-  // clang-format on
+  host_lock_address((void*)dest, scope);
 
   host_atomic_thread_fence(MemoryOrderAcquire(), scope);
   T return_val = *dest;
@@ -100,16 +177,16 @@ std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value, T> host_atomic_e
 }
 
 template <class T, class MemoryOrder, class MemoryScope>
-std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value, T>
+std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value &&
+                     !host_atomic_cas16_available_gcc<T>::value,
+                 T>
 host_atomic_compare_exchange(T* const dest,
                              dont_deduce_this_parameter_t<const T> compare,
                              dont_deduce_this_parameter_t<const T> val,
                              MemoryOrder /*order*/,
                              MemoryScope scope) {
   // Acquire a lock for the address
-  // clang-format off
-  while (!lock_address((void*)dest, scope)) {}
-  // clang-format on
+  host_lock_address((void*)dest, scope);
 
   host_atomic_thread_fence(MemoryOrderAcquire(), scope);
   T return_val = *dest;
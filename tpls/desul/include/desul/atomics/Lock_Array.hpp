@@ -25,19 +25,35 @@ namespace desul {
 namespace Impl {
 
 struct HostLocks {
-  static constexpr uint32_t HOST_SPACE_ATOMIC_MASK = 0xFFFF;
-  static constexpr uint32_t HOST_SPACE_ATOMIC_XOR_MASK = 0x5A39;
+  // Each lock sits in its own cache line so that threads spinning on different
+  // locks do not invalidate each other, and addresses are hashed so that
+  // neighbouring elements of an array land in unrelated lines.
+  static constexpr uint32_t HOST_SPACE_ATOMIC_MASK = 0x1FFF;
+  static constexpr uint32_t HOST_SPACE_ATOMIC_HASH_SHIFT = 64 - 13;
+  static constexpr uint32_t HOST_SPACE_ATOMIC_LOCK_STRIDE = 64 / sizeof(int32_t);
   template <class is_always_void = void>
   static int32_t* get_host_locks_() {
-    static int32_t HOST_SPACE_ATOMIC_LOCKS_DEVICE[HOST_SPACE_ATOMIC_MASK + 1] = {};
+    alignas(64) static int32_t HOST_SPACE_ATOMIC_LOCKS_DEVICE
+        [(HOST_SPACE_ATOMIC_MASK + 1) * HOST_SPACE_ATOMIC_LOCK_STRIDE] = {};
     return HOST_SPACE_ATOMIC_LOCKS_DEVICE;
   }
   static inline int32_t* get_host_lock_(void* ptr) {
-    return &get_host_locks_()[((uint64_t(ptr) >> 2) & HOST_SPACE_ATOMIC_MASK) ^
-                              HOST_SPACE_ATOMIC_XOR_MASK];
+    // Fibonacci hashing of the 8-byte granule, keeping the top bits
+    uint32_t const index = uint32_t(((uint64_t(ptr) >> 3) * 0x9E3779B97F4A7C15ull) >>
+                                    HOST_SPACE_ATOMIC_HASH_SHIFT) &
+                           HOST_SPACE_ATOMIC_MASK;
+    return &get_host_locks_()[index * HOST_SPACE_ATOMIC_LOCK_STRIDE];
   }
 };
 
+inline void host_lock_spin_pause() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_ia32_pause();
+#elif defined(__GNUC__) && defined(__aarch64__)
+  __asm__ __volatile__("yield" ::: "memory");
+#endif
+}
+
 inline void init_lock_arrays() {
   static bool is_initialized = false;
   if (!is_initialized) {
@@ -76,8 +92,27 @@ inline void ensure_lock_arrays_on_device() {
 
 template <class MemoryScope>
 bool lock_address(void* ptr, MemoryScope ms) {
-  return 0 == atomic_exchange(
-                  HostLocks::get_host_lock_(ptr), int32_t(1), MemoryOrderSeqCst(), ms);
+  int32_t* const lock = HostLocks::get_host_lock_(ptr);
+  // test before test-and-set so that waiting threads only read the line
+  if (*static_cast<volatile int32_t*>(lock) != 0) {
+    return false;
+  }
+  return 0 == atomic_exchange(lock, int32_t(1), MemoryOrderSeqCst(), ms);
+}
+
+// Blocking variant of lock_address for host code, backing off exponentially
+// while the lock is held.
+template <class MemoryScope>
+void host_lock_address(void* ptr, MemoryScope ms) {
+  int backoff = 1;
+  while (!lock_address(ptr, ms)) {
+    for (int i = 0; i < backoff; ++i) {
+      host_lock_spin_pause();
+    }
+    if (backoff < 64) {
+      backoff *= 2;
+    }
+  }
 }
 
 template <class MemoryScope>
@@ -11,27 +11,34 @@ SPDX-License-Identifier: (BSD-3-Clause)
 
 #include <desul/atomics/Common.hpp>
 #include <desul/atomics/Lock_Array.hpp>
+#include <desul/atomics/Operator_Function_Objects.hpp>
 #include <desul/atomics/Thread_Fence.hpp>
 #include <type_traits>
 
 namespace desul {
 namespace Impl {
 
+template <class T>
+struct host_atomic_use_lock_array {
+  constexpr static bool value = !atomic_always_lock_free(sizeof(T))
+#ifdef DESUL_IMPL_HAVE_HOST_COMPARE_AND_SWAP_16
+                                && !host_atomic_cas16_available_gcc<T>::value
+#endif
+      ;
+};
+
 template <class Oper,
           class T,
           class MemoryOrder,
           class MemoryScope,
-          // equivalent to:
-          //   requires !atomic_always_lock_free(sizeof(T))
-          std::enable_if_t<!atomic_always_lock_free(sizeof(T)), int> = 0>
+          std::enable_if_t<host_atomic_use_lock_array<T>::value, int> = 0>
 inline T host_atomic_fetch_oper(const Oper& op,
                                 T* const dest,
                                 dont_deduce_this_parameter_t<const T> val,
                                 MemoryOrder /*order*/,
                                 MemoryScope scope) {
   // Acquire a lock for the address
-  while (!lock_address((void*)dest, scope)) {
-  }
+  host_lock_address((void*)dest, scope);
 
   host_atomic_thread_fence(MemoryOrderAcquire(), scope);
   T return_val = *dest;
@@ -45,17 +52,14 @@ template <class Oper,
           class T,
           class MemoryOrder,
           class MemoryScope,
-          // equivalent to:
-          //   requires !atomic_always_lock_free(sizeof(T))
-          std::enable_if_t<!atomic_always_lock_free(sizeof(T)), int> = 0>
+          std::enable_if_t<host_atomic_use_lock_array<T>::value, int> = 0>
 inline T host_atomic_oper_fetch(const Oper& op,
                                 T* const dest,
                                 dont_deduce_this_parameter_t<const T> val,
                                 MemoryOrder /*order*/,
                                 MemoryScope scope) {
   // Acquire a lock for the address
-  while (!lock_address((void*)dest, scope)) {
-  }
+  host_lock_address((void*)dest, scope);
 
   host_atomic_thread_fence(MemoryOrderAcquire(), scope);
   T return_val = op.apply(*dest, val);
@@ -65,6 +69,50 @@ inline T host_atomic_oper_fetch(const Oper& op,
   return return_val;
 }
 
+#ifdef DESUL_IMPL_HAVE_HOST_COMPARE_AND_SWAP_16
+template <class Oper,
+          class T,
+          class MemoryOrder,
+          class MemoryScope,
+          std::enable_if_t<host_atomic_cas16_available_gcc<T>::value, int> = 0>
+inline T host_atomic_fetch_oper(const Oper& op,
+                                T* const dest,
+                                dont_deduce_this_parameter_t<const T> val,
+                                MemoryOrder /*order*/,
+                                MemoryScope /*scope*/) {
+  T oldval = *dest;
+  T assume;
+  do {
+    if (check_early_exit(op, oldval, val)) return oldval;
+    assume = oldval;
+    oldval = host_atomic_cas16_gcc(dest, assume, op.apply(assume, val));
+  } while (!host_atomic_cas16_same_bits_gcc(assume, oldval));
+  return oldval;
+}
+
+template <class Oper,
+          class T,
+          class MemoryOrder,
+          class MemoryScope,
+          std::enable_if_t<host_atomic_cas16_available_gcc<T>::value, int> = 0>
+inline T host_atomic_oper_fetch(const Oper& op,
+                                T* const dest,
+                                dont_deduce_this_parameter_t<const T> val,
+                                MemoryOrder /*order*/,
+                                MemoryScope /*scope*/) {
+  T oldval = *dest;
+  T assume;
+  T newval;
+  do {
+    if (check_early_exit(op, oldval, val)) return oldval;
+    assume = oldval;
+    newval = op.apply(assume, val);
+    oldval = host_atomic_cas16_gcc(dest, assume, newval);
+  } while (!host_atomic_cas16_same_bits_gcc(assume, oldval));
+  return newval;
+}
+#endif
+
 }  // namespace Impl
 }  // namespace desul
 